@@ -28,6 +28,8 @@ ie_dependent_option (ENABLE_ONEDNN_FOR_GPU "Enable oneDNN with GPU support" ${EN
 
 ie_option (ENABLE_PROFILING_ITT "Build with ITT tracing. Optionally configure pre-built ittnotify library though INTEL_VTUNE_DIR variable." OFF)
 
+ie_option (ENABLE_PROFILING_TRACE "Build with the in-process tracer of the ITT tasks, which writes Chrome trace JSON to OPENVINO_TRACE_FILE. Replaces the ITT backend." OFF)
+
 ie_option_enum(ENABLE_PROFILING_FILTER "Enable or disable ITT counter groups.\
 Supported values:\
  ALL - enable all ITT counters (default value)\
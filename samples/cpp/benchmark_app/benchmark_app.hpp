@@ -196,6 +196,27 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for open-loop arrival rate option
+static const char rate_message[] =
+    "Optional. Open-loop mode: issue requests at the given arrival rate (requests per second) instead of resubmitting "
+    "each request as soon as it completes. Latency includes the time a request waits for an idle infer request. "
+    "A comma-separated list of rates runs a sweep and reports the knee of the latency/throughput curve. "
+    "Supported with -api async only.";
+
+/// @brief message for open-loop arrival process option
+static const char arrival_message[] =
+    "Optional. Arrival process of the open-loop mode: \"constant\" (default) or \"poisson\".";
+
+/// @brief message for latency distribution option
+static const char latency_hist_message[] =
+    "Optional. Report latency distribution: p50/p90/p99/p99.9 percentiles, jitter, HDR-style latency histogram and "
+    "per-second throughput time series. The histogram and time series are stored to the statistics report.";
+
+/// @brief message for warm-up duration option
+static const char warmup_message[] =
+    "Optional. Warm-up duration in seconds. Inferences executed during warm-up are reported separately and excluded "
+    "from the resulting statistics. By default only the first inference is a warm-up.";
+
 // @brief message for report_type option
 static const char report_type_message[] =
     "Optional. Enable collecting statistics report. \"no_counters\" report contains "
@@ -363,6 +384,18 @@ DEFINE_bool(use_device_mem, false, use_device_mem_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Open-loop arrival rates
+DEFINE_string(rate, "", rate_message);
+
+/// @brief Open-loop arrival process
+DEFINE_string(arrival, "constant", arrival_message);
+
+/// @brief Enables latency distribution reporting
+DEFINE_bool(latency_hist, false, latency_hist_message);
+
+/// @brief Warm-up duration in seconds
+DEFINE_uint64(warmup, 0, warmup_message);
+
 /// @brief Enables statistics report collecting
 DEFINE_string(report_type, "", report_type_message);
 
@@ -421,6 +454,8 @@ static void show_usage() {
     std::cout << "    -nireq  <integer>             " << infer_requests_count_message << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
+    std::cout << "    -rate  <rate[,rate...]>       " << rate_message << std::endl;
+    std::cout << "    -arrival  <constant/poisson>  " << arrival_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
     std::cout << std::endl;
     std::cout << "Preprocessing options:" << std::endl;
@@ -440,6 +475,8 @@ static void show_usage() {
     std::cout << std::endl;
     std::cout << "Statistics dumping options:" << std::endl;
     std::cout << "    -latency_percentile     " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -latency_hist           " << latency_hist_message << std::endl;
+    std::cout << "    -warmup  <integer>      " << warmup_message << std::endl;
     std::cout << "    -report_type  <type>    " << report_type_message << std::endl;
     std::cout << "    -report_folder          " << report_folder_message << std::endl;
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
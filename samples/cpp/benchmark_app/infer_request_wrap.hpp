@@ -51,6 +51,13 @@ public:
         _request.start_async();
     }
 
+    /// @brief starts the request that arrived at the given time (open-loop load),
+    /// so the measured latency includes the time the request waited to be started
+    void start_async(Time::time_point arrival) {
+        _startTime = arrival;
+        _request.start_async();
+    }
+
     void wait() {
         _request.wait();
     }
@@ -138,6 +145,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _completion_times.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -156,6 +164,7 @@ public:
             inferenceException = ptr;
         } else {
             _latencies.push_back(latency);
+            _completion_times.push_back(Time::now());
             if (enable_lat_groups) {
                 _latency_groups[lat_group_id].push_back(latency);
             }
@@ -193,6 +202,16 @@ public:
         return _latencies;
     }
 
+    /// @brief completion time of every request in milliseconds since the first request was started
+    std::vector<double> get_completion_times() {
+        std::vector<double> times;
+        times.reserve(_completion_times.size());
+        for (auto& time : _completion_times) {
+            times.push_back(std::chrono::duration_cast<ns>(time - _startTime).count() * 0.000001);
+        }
+        return times;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -206,6 +225,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<Time::time_point> _completion_times;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "latency_distribution.hpp"
+// clang-format on
+
+namespace {
+// bounds (in microseconds) of the HDR-style bucket containing the value
+std::pair<uint64_t, uint64_t> bucket_bounds(uint64_t us) {
+    if (us < LatencyDistribution::sub_buckets) {
+        return {us, us + 1};
+    }
+    uint64_t range = LatencyDistribution::sub_buckets;
+    while (us >= range * 2) {
+        range *= 2;
+    }
+    const uint64_t width = range / LatencyDistribution::sub_buckets;
+    const uint64_t lower = us / width * width;
+    return {lower, lower + width};
+}
+}  // namespace
+
+LatencyDistribution::LatencyDistribution(const std::vector<double>& latencies,
+                                         const std::vector<double>& completion_times) {
+    if (latencies.empty()) {
+        throw std::logic_error("Latency distribution class expects non-empty vector of latencies at construction.");
+    }
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    for (double percentile : {50.0, 90.0, 99.0, 99.9}) {
+        // nearest-rank percentile
+        auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+        percentiles.emplace_back(percentile, sorted[std::max<size_t>(rank, 1) - 1]);
+    }
+
+    const double avg = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+    double variance = 0;
+    for (auto latency : latencies) {
+        variance += (latency - avg) * (latency - avg);
+    }
+    stddev = std::sqrt(variance / latencies.size());
+    if (latencies.size() > 1) {
+        double diffs = 0;
+        for (size_t i = 1; i < latencies.size(); i++) {
+            diffs += std::abs(latencies[i] - latencies[i - 1]);
+        }
+        jitter = diffs / (latencies.size() - 1);
+    }
+
+    fill_histogram(latencies);
+    fill_throughput_timeline(completion_times);
+}
+
+void LatencyDistribution::fill_histogram(const std::vector<double>& latencies) {
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> buckets;
+    for (auto latency : latencies) {
+        auto bounds = bucket_bounds(static_cast<uint64_t>(latency * 1000.0));
+        auto& bucket = buckets[bounds.first];
+        bucket.first = bounds.second;
+        bucket.second++;
+    }
+    histogram.reserve(buckets.size());
+    for (auto& bucket : buckets) {
+        histogram.push_back({bucket.first / 1000.0, bucket.second.first / 1000.0, bucket.second.second});
+    }
+}
+
+void LatencyDistribution::fill_throughput_timeline(const std::vector<double>& completion_times) {
+    for (auto time : completion_times) {
+        auto second = static_cast<size_t>(std::max(time, 0.0) / 1000.0);
+        if (second >= throughput_timeline.size()) {
+            throughput_timeline.resize(second + 1, 0);
+        }
+        throughput_timeline[second]++;
+    }
+}
+
+std::string LatencyDistribution::percentile_name(double percentile) {
+    std::string name = "p" + double_to_string(percentile);
+    // drop the meaningless trailing zeros: p50.00 -> p50, p99.90 -> p99.9
+    name.erase(name.find_last_not_of('0') + 1);
+    if (name.back() == '.') {
+        name.pop_back();
+    }
+    return name;
+}
+
+void LatencyDistribution::write_to_slog() const {
+    for (auto& percentile : percentiles) {
+        std::string label = "   " + percentile_name(percentile.first) + ":";
+        label.resize(std::max<size_t>(label.size(), 21), ' ');
+        slog::info << label << double_to_string(percentile.second) << " ms" << slog::endl;
+    }
+    slog::info << "   Std deviation:    " << double_to_string(stddev) << " ms" << slog::endl;
+    slog::info << "   Jitter:           " << double_to_string(jitter) << " ms" << slog::endl;
+}
@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// @brief Responsible for calculating the latency distribution of a benchmark run: tail percentiles,
+/// jitter, HDR-style latency histogram and throughput time series
+class LatencyDistribution {
+public:
+    struct Bucket {
+        double lower;  // ms, inclusive
+        double upper;  // ms, exclusive
+        uint64_t count;
+    };
+
+    LatencyDistribution() {}
+
+    /// @param latencies request latencies (ms) in the order of completion
+    /// @param completion_times completion time of every request (ms since the measurement start)
+    LatencyDistribution(const std::vector<double>& latencies, const std::vector<double>& completion_times);
+
+    void write_to_slog() const;
+
+    /// @brief short name of the percentile, e.g. p50 or p99.9
+    static std::string percentile_name(double percentile);
+
+    // (percentile, latency ms) pairs: p50, p90, p99, p99.9
+    std::vector<std::pair<double, double>> percentiles;
+    // standard deviation of the latency
+    double stddev = 0;
+    // mean absolute difference of the latencies of consecutively completed requests
+    double jitter = 0;
+    // non-empty histogram buckets in ascending order
+    std::vector<Bucket> histogram;
+    // number of completed requests in every second of the measurement
+    std::vector<uint64_t> throughput_timeline;
+
+    // every power of two range of microseconds is split into this number of linear buckets,
+    // so the relative error of a bucket is below 1 / sub_buckets
+    static constexpr uint64_t sub_buckets = 32;
+
+private:
+    void fill_histogram(const std::vector<double>& latencies);
+    void fill_throughput_timeline(const std::vector<double>& completion_times);
+};
@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "samples/common.hpp"
+
+#include "load_generator.hpp"
+// clang-format on
+
+ArrivalSchedule::ArrivalSchedule(double rate, bool poisson, Time::time_point start)
+    : _rate(rate),
+      _poisson(poisson),
+      _start(start) {
+    // the inter-arrival interval is derived from the rate, so the rate is validated first
+    if (rate <= 0) {
+        throw std::logic_error("Arrival rate must be positive");
+    }
+    _interval = std::exponential_distribution<double>(rate);
+}
+
+Time::time_point ArrivalSchedule::next() {
+    auto arrival = _start + std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(_next));
+    _next += _poisson ? _interval(_generator) : 1.0 / _rate;
+    return arrival;
+}
+
+std::vector<double> parse_arrival_rates(const std::string& rates) {
+    std::vector<double> result;
+    for (auto& rate : split(rates, ',')) {
+        try {
+            result.push_back(std::stod(rate));
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse arrival rate: " + rate);
+        }
+        if (result.back() <= 0) {
+            throw std::logic_error("Arrival rate must be positive: " + rate);
+        }
+    }
+    return result;
+}
+
+size_t find_latency_knee(const std::vector<RateSweepPoint>& sweep) {
+    if (sweep.empty()) {
+        return 0;
+    }
+    auto lowest = std::min_element(sweep.begin(), sweep.end(), [](const RateSweepPoint& a, const RateSweepPoint& b) {
+        return a.offered_rate < b.offered_rate;
+    });
+    size_t knee = sweep.size();
+    for (size_t i = 0; i < sweep.size(); i++) {
+        const auto& point = sweep[i];
+        bool sustained = point.achieved_rate >= 0.95 * point.offered_rate;
+        bool bounded = point.latency_p99 <= 2 * lowest->latency_p99;
+        if (sustained && bounded && (knee == sweep.size() || point.offered_rate > sweep[knee].offered_rate)) {
+            knee = i;
+        }
+    }
+    return knee;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "utils.hpp"
+
+/// @brief Generates request arrival times of the open-loop load with a constant or Poisson arrival process
+class ArrivalSchedule {
+public:
+    /// @param rate arrival rate in requests per second
+    /// @param poisson use exponentially distributed inter-arrival times instead of the constant ones
+    ArrivalSchedule(double rate, bool poisson, Time::time_point start = Time::now());
+
+    /// @brief returns the arrival time of the next request
+    Time::time_point next();
+
+private:
+    double _rate;
+    bool _poisson;
+    Time::time_point _start;
+    // arrival time of the next request in seconds since the start
+    double _next = 0;
+    // fixed seed keeps the arrivals reproducible between runs
+    std::mt19937 _generator{42};
+    std::exponential_distribution<double> _interval;
+};
+
+/// @brief Results of the open-loop run at a single arrival rate
+struct RateSweepPoint {
+    double offered_rate;  // requests per second
+    double achieved_rate;  // requests per second
+    double latency_p50;   // ms, including queueing
+    double latency_p99;   // ms, including queueing
+    double queueing_avg;  // ms, average wait for an idle infer request
+};
+
+/// @brief parses the comma-separated list of arrival rates passed to -rate
+std::vector<double> parse_arrival_rates(const std::string& rates);
+
+/// @brief finds the knee of the latency/throughput curve: the highest offered rate that is still
+/// sustained (achieved rate within 5% of the offered one) with p99 latency below twice the p99
+/// at the lowest rate. Returns the index of the point, or the size of the sweep if none qualifies.
+size_t find_latency_knee(const std::vector<RateSweepPoint>& sweep);
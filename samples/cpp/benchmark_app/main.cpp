@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -53,6 +55,15 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (!FLAGS_rate.empty() && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode (-rate option) is supported with -api async only.");
+    }
+    if (FLAGS_arrival != "constant" && FLAGS_arrival != "poisson") {
+        throw std::logic_error("Incorrect arrival process. Please set -arrival option to `constant` or `poisson`.");
+    }
+    if (!FLAGS_rate.empty()) {
+        parse_arrival_rates(FLAGS_rate);
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -1156,20 +1167,14 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
-        size_t processedFramesN = 0;
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
-        /** Start inference & calculate performance **/
-        /** to align number if iterations to guarantee that last infer requests are
-         * executed in the same conditions **/
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.get_idle_request();
+        // starts the next inference, the arrival time is set for the open-loop load only.
+        // Returns the time the idle infer request was taken, before the inputs are set
+        auto start_inference = [&](size_t iteration, Time::time_point arrival) {
+            auto inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 throw ov::Exception("No idle Infer Requests!");
             }
+            const auto scheduledTime = Time::now();
 
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
@@ -1199,19 +1204,106 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (arrival != Time::time_point::min()) {
+                inferRequest->start_async(arrival);
             } else {
                 inferRequest->start_async();
             }
-            ++iteration;
+            return scheduledTime;
+        };
+
+        if (FLAGS_warmup != 0) {
+            // warming up for the requested duration - reported separately and excluded from the results
+            uint64_t warmupIterations = 0;
+            auto warmupStartTime = Time::now();
+            while ((uint64_t)std::chrono::duration_cast<ns>(Time::now() - warmupStartTime).count() <
+                       get_duration_in_nanoseconds(FLAGS_warmup) ||
+                   (FLAGS_api == "async" && warmupIterations % nireq != 0)) {
+                start_inference(warmupIterations++, Time::time_point::min());
+            }
+            inferRequestsQueue.wait_all();
+
+            LatencyMetrics warmupLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+            slog::info << "Warm-up: " << warmupIterations << " iterations in "
+                       << double_to_string(inferRequestsQueue.get_duration_in_milliseconds()) << " ms" << slog::endl;
+            warmupLatency.write_to_slog();
+            if (statistics) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("warm-up number of iterations", "warmup_iterations_num", warmupIterations),
+                     StatisticsVariant("warm-up average latency (ms)", "warmup_latency_avg", warmupLatency.avg),
+                     StatisticsVariant("warm-up max latency (ms)", "warmup_latency_max", warmupLatency.max)});
+            }
+            inferRequestsQueue.reset_times();
+        }
+
+        size_t processedFramesN = 0;
+        auto startTime = Time::now();
+        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-            processedFramesN += batchSize;
+        /** Start inference & calculate performance **/
+        /** to align number if iterations to guarantee that last infer requests are
+         * executed in the same conditions **/
+        const auto arrivalRates = parse_arrival_rates(FLAGS_rate);
+        std::vector<RateSweepPoint> rateSweep;
+        // total time (ms) the open-loop requests waited for an idle infer request
+        double queueingTime = 0;
+        if (arrivalRates.empty()) {
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                   (FLAGS_api == "async" && iteration % nireq != 0)) {
+                start_inference(iteration, Time::time_point::min());
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+            }
+        }
+        for (size_t r = 0; r < arrivalRates.size(); r++) {
+            if (r != 0) {
+                // the results of the last rate are reported as the resulting statistics below
+                inferRequestsQueue.reset_times();
+                iteration = 0;
+                processedFramesN = 0;
+                queueingTime = 0;
+                startTime = Time::now();
+                execTime = 0;
+            }
+            /** Open-loop: requests are issued at the arrival times independently of the completions **/
+            ArrivalSchedule arrivals(arrivalRates[r], FLAGS_arrival == "poisson", startTime);
+            while ((niter != 0LL && iteration < niter) ||
+                   (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds)) {
+                // the arrival time is taken from the schedule, so the late wake-up and the wait for
+                // an idle infer request are counted in the latency, the input setup is not a queueing delay
+                const auto arrival = arrivals.next();
+                std::this_thread::sleep_until(arrival);
+                const auto scheduledTime = start_inference(iteration, arrival);
+                queueingTime += std::chrono::duration_cast<ns>(scheduledTime - arrival).count() * 0.000001;
+                ++iteration;
+
+                execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+                processedFramesN += batchSize;
+            }
+            inferRequestsQueue.wait_all();
+
+            LatencyDistribution rateLatency(inferRequestsQueue.get_latencies(),
+                                            inferRequestsQueue.get_completion_times());
+            rateSweep.push_back({arrivalRates[r],
+                                 1000.0 * iteration / inferRequestsQueue.get_duration_in_milliseconds(),
+                                 rateLatency.percentiles[0].second,  // p50
+                                 rateLatency.percentiles[2].second,  // p99
+                                 queueingTime / iteration});
         }
 
         // wait the latest inference executions
         inferRequestsQueue.wait_all();
 
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
+        LatencyDistribution latencyDistribution;
+        if (FLAGS_latency_hist) {
+            latencyDistribution =
+                LatencyDistribution(inferRequestsQueue.get_latencies(), inferRequestsQueue.get_completion_times());
+        }
         std::vector<LatencyMetrics> groupLatencies = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
@@ -1251,6 +1343,20 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                if (FLAGS_latency_hist) {
+                    StatisticsReport::Parameters distribution;
+                    for (auto& percentile : latencyDistribution.percentiles) {
+                        auto name = LatencyDistribution::percentile_name(percentile.first);
+                        auto json_name = name;
+                        std::replace(json_name.begin(), json_name.end(), '.', '_');
+                        distribution.emplace_back("latency " + name + " (ms)", "latency_" + json_name, percentile.second);
+                    }
+                    distribution.emplace_back("latency std deviation (ms)", "latency_stddev", latencyDistribution.stddev);
+                    distribution.emplace_back("latency jitter (ms)", "latency_jitter", latencyDistribution.jitter);
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, distribution);
+                    statistics->add_latency_distribution(latencyDistribution);
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1261,6 +1367,15 @@ int main(int argc, char* argv[]) {
             }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
+            if (!rateSweep.empty()) {
+                statistics->add_parameters(
+                    StatisticsReport::Category::EXECUTION_RESULTS,
+                    {StatisticsVariant("arrival rate (requests/s)", "arrival_rate", rateSweep.back().offered_rate),
+                     StatisticsVariant("average queueing delay (ms)",
+                                       "queueing_avg",
+                                       rateSweep.back().queueing_avg)});
+                statistics->add_rate_sweep(rateSweep);
+            }
         }
         // ----------------- 11. Dumping statistics report
         // -------------------------------------------------------------
@@ -1318,6 +1433,9 @@ int main(int argc, char* argv[]) {
         if (device_name.find("MULTI") == std::string::npos) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
+            if (FLAGS_latency_hist) {
+                latencyDistribution.write_to_slog();
+            }
 
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
@@ -1339,6 +1457,28 @@ int main(int argc, char* argv[]) {
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
+        if (!rateSweep.empty()) {
+            slog::info << "Open-loop " << FLAGS_arrival << " arrivals:" << slog::endl;
+            slog::info << "   Offered (req/s)   Achieved (req/s)   p50 (ms)   p99 (ms)   Queueing avg (ms)"
+                       << slog::endl;
+            for (auto& point : rateSweep) {
+                slog::info << "   " << std::setw(15) << double_to_string(point.offered_rate) << "   " << std::setw(16)
+                           << double_to_string(point.achieved_rate) << "   " << std::setw(8)
+                           << double_to_string(point.latency_p50) << "   " << std::setw(8)
+                           << double_to_string(point.latency_p99) << "   " << std::setw(17)
+                           << double_to_string(point.queueing_avg) << slog::endl;
+            }
+            if (rateSweep.size() > 1) {
+                auto knee = find_latency_knee(rateSweep);
+                if (knee < rateSweep.size()) {
+                    slog::info << "Knee of the latency/throughput curve: "
+                               << double_to_string(rateSweep[knee].offered_rate) << " requests/s" << slog::endl;
+                } else {
+                    slog::warn << "None of the arrival rates is sustained with bounded latency" << slog::endl;
+                }
+            }
+        }
+
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -21,6 +21,15 @@ void StatisticsReport::add_parameters(const Category& category, const Parameters
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::add_latency_distribution(const LatencyDistribution& distribution) {
+    _latency_distribution = distribution;
+    _has_latency_distribution = true;
+}
+
+void StatisticsReport::add_rate_sweep(const std::vector<RateSweepPoint>& sweep) {
+    _rate_sweep = sweep;
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv", 3);
 
@@ -67,6 +76,53 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_has_latency_distribution) {
+        dumper << "Latency histogram";
+        dumper.endLine();
+        dumper << "Lower bound (ms)"
+               << "Upper bound (ms)"
+               << "Count";
+        dumper.endLine();
+        for (auto& bucket : _latency_distribution.histogram) {
+            dumper << bucket.lower << bucket.upper << bucket.count;
+            dumper.endLine();
+        }
+        dumper.endLine();
+
+        dumper << "Throughput timeline";
+        dumper.endLine();
+        dumper << "Second"
+               << "Completed requests";
+        dumper.endLine();
+        for (size_t i = 0; i < _latency_distribution.throughput_timeline.size(); i++) {
+            dumper << i << _latency_distribution.throughput_timeline[i];
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
+    if (!_rate_sweep.empty()) {
+        dumper << "Open-loop rate sweep";
+        dumper.endLine();
+        dumper << "Offered rate (requests/s)"
+               << "Achieved rate (requests/s)"
+               << "p50 latency (ms)"
+               << "p99 latency (ms)"
+               << "Average queueing (ms)";
+        dumper.endLine();
+        for (auto& point : _rate_sweep) {
+            dumper << point.offered_rate << point.achieved_rate << point.latency_p50 << point.latency_p99
+                   << point.queueing_avg;
+            dumper.endLine();
+        }
+        auto knee = find_latency_knee(_rate_sweep);
+        if (knee < _rate_sweep.size()) {
+            dumper << "Knee (requests/s)" << _rate_sweep[knee].offered_rate;
+            dumper.endLine();
+        }
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -227,6 +283,33 @@ void StatisticsReportJSON::dump() {
     if (_parameters.count(Category::EXECUTION_RESULTS_GROUPPED)) {
         dump_parameters(js["execution_results"], _parameters.at(Category::EXECUTION_RESULTS_GROUPPED));
     }
+    if (_has_latency_distribution) {
+        auto& histogram = js["latency_histogram"] = nlohmann::json::array();
+        for (auto& bucket : _latency_distribution.histogram) {
+            nlohmann::json item;
+            item["lower"] = bucket.lower;
+            item["upper"] = bucket.upper;
+            item["count"] = bucket.count;
+            histogram.push_back(item);
+        }
+        js["throughput_timeline"] = _latency_distribution.throughput_timeline;
+    }
+    if (!_rate_sweep.empty()) {
+        auto& sweep = js["rate_sweep"] = nlohmann::json::array();
+        for (auto& point : _rate_sweep) {
+            nlohmann::json item;
+            item["offered_rate"] = point.offered_rate;
+            item["achieved_rate"] = point.achieved_rate;
+            item["latency_p50"] = point.latency_p50;
+            item["latency_p99"] = point.latency_p99;
+            item["queueing_avg"] = point.queueing_avg;
+            sweep.push_back(item);
+        }
+        auto knee = find_latency_knee(_rate_sweep);
+        if (knee < _rate_sweep.size()) {
+            js["rate_knee"] = _rate_sweep[knee].offered_rate;
+        }
+    }
 
     std::ofstream out_stream(name);
     out_stream << std::setw(4) << js << std::endl;
@@ -21,6 +21,8 @@
 #include "samples/slog.hpp"
 #include "samples/latency_metrics.hpp"
 
+#include "latency_distribution.hpp"
+#include "load_generator.hpp"
 #include "utils.hpp"
 // clang-format on
 
@@ -115,6 +117,10 @@ public:
 
     void add_parameters(const Category& category, const Parameters& parameters);
 
+    void add_latency_distribution(const LatencyDistribution& distribution);
+
+    void add_rate_sweep(const std::vector<RateSweepPoint>& sweep);
+
     virtual void dump();
 
     virtual void dump_performance_counters(const std::vector<PerformanceCounters>& perfCounts);
@@ -133,6 +139,13 @@ protected:
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // latency histogram and throughput time series, reported when requested
+    bool _has_latency_distribution = false;
+    LatencyDistribution _latency_distribution;
+
+    // open-loop results per arrival rate
+    std::vector<RateSweepPoint> _rate_sweep;
+
     // csv separator
     std::string _separator;
 
@@ -6,7 +6,9 @@
 
 #include <cstdlib>
 
-#ifdef ENABLE_PROFILING_ITT
+#ifdef ENABLE_PROFILING_TRACE
+#    include "trace.hpp"
+#elif defined(ENABLE_PROFILING_ITT)
 #    include <ittnotify.h>
 #endif
 
@@ -14,7 +16,7 @@ namespace openvino {
 namespace itt {
 namespace internal {
 
-#ifdef ENABLE_PROFILING_ITT
+#if defined(ENABLE_PROFILING_TRACE) || defined(ENABLE_PROFILING_ITT)
 
 static size_t callStackDepth() {
     static const char* env = std::getenv("OPENVINO_TRACE_DEPTH");
@@ -24,6 +26,35 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+#endif
+
+#ifdef ENABLE_PROFILING_TRACE
+
+// the handles are the interned names, so the tracer gets the names without any lookup
+domain_t domain(char const* name) {
+    return reinterpret_cast<domain_t>(const_cast<char*>(trace::intern(name)));
+}
+
+handle_t handle(char const* name) {
+    return reinterpret_cast<handle_t>(const_cast<char*>(trace::intern(name)));
+}
+
+void taskBegin(domain_t d, handle_t t) {
+    if (!callStackDepth() || call_stack_depth++ < callStackDepth())
+        trace::begin(reinterpret_cast<const char*>(d), reinterpret_cast<const char*>(t));
+}
+
+void taskEnd(domain_t) {
+    if (!callStackDepth() || --call_stack_depth < callStackDepth())
+        trace::end();
+}
+
+void threadName(const char* name) {
+    trace::threadName(name);
+}
+
+#elif defined(ENABLE_PROFILING_ITT)
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
@@ -65,7 +96,7 @@ void taskEnd(domain_t) {}
 
 void threadName(const char*) {}
 
-#endif  // ENABLE_PROFILING_ITT
+#endif  // ENABLE_PROFILING_TRACE
 
 }  // namespace internal
 }  // namespace itt
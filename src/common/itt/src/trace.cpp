@@ -0,0 +1,237 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef ENABLE_PROFILING_TRACE
+
+#    include "trace.hpp"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <cstdint>
+#    include <cstdio>
+#    include <cstdlib>
+#    include <fstream>
+#    include <memory>
+#    include <mutex>
+#    include <string>
+#    include <thread>
+#    include <unordered_set>
+#    include <vector>
+
+#    ifdef _WIN32
+#        include <process.h>
+#        define getpid _getpid
+#    else
+#        include <unistd.h>
+#    endif
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+namespace {
+
+struct Event {
+    uint64_t ts;
+    // the interned names, the end of the task has no name
+    const char* name;
+    const char* category;
+};
+
+// Every thread writes to its own buffer, so the threads don't contend for it.
+// The oldest events are overwritten when the buffer is full.
+struct ThreadBuffer {
+    explicit ThreadBuffer(size_t capacity, uint64_t id) : events(capacity), tid(id) {}
+
+    std::vector<Event> events;
+    std::atomic<uint64_t> written{0};
+    // set while the thread writes the event, the dump waits for it
+    std::atomic<bool> writing{false};
+    const uint64_t tid;
+    std::atomic<const char*> name{nullptr};
+};
+
+size_t bufferCapacity() {
+    static const char* env = std::getenv("OPENVINO_TRACE_BUFFER_SIZE");
+    static const size_t capacity = env ? std::max<size_t>(std::strtoul(env, nullptr, 10), 1) : (1 << 16);
+    return capacity;
+}
+
+std::string escape(const char* str) {
+    std::string result;
+    for (; *str; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            result.push_back('\\');
+            result.push_back(c);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            result.append(code);
+        } else {
+            result.push_back(c);
+        }
+    }
+    return result;
+}
+
+class Tracer {
+public:
+    // The tracer is never destroyed, so the tasks of the static objects destroyed after the dump are safe to record
+    static Tracer& get() {
+        static Tracer* tracer = new Tracer();
+        return *tracer;
+    }
+
+    bool enabled() const {
+        return !path.empty();
+    }
+
+    const char* intern(const char* str) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return strings.insert(str).first->c_str();
+    }
+
+    void record(const char* name, const char* category) {
+        auto& buffer = local();
+        // Both the flag and the check are sequentially consistent, so either the dump waits for the event
+        // or the event sees the recording stopped
+        buffer.writing.store(true);
+        if (!stopped.load()) {
+            const auto index = buffer.written.load(std::memory_order_relaxed);
+            buffer.events[index % buffer.events.size()] = {now(), name, category};
+            buffer.written.store(index + 1, std::memory_order_relaxed);
+        }
+        buffer.writing.store(false);
+    }
+
+    // The recording is stopped until all the events being written are finished and the file is written.
+    // The events recorded at this time are dropped. The recording isn't resumed after the final dump at the exit,
+    // since the other threads may still run.
+    void dump(bool resume) {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped.store(true);
+        for (const auto& buffer : buffers) {
+            while (buffer->writing.load())
+                std::this_thread::yield();
+        }
+        write();
+        if (resume)
+            stopped.store(false);
+    }
+
+    void setThreadName(const char* name) {
+        local().name.store(intern(name));
+    }
+
+private:
+    Tracer() : start(std::chrono::steady_clock::now()) {
+        if (const char* env = std::getenv("OPENVINO_TRACE_FILE"))
+            path = env;
+        if (enabled())
+            std::atexit([] {
+                get().dump(false);
+            });
+    }
+
+    uint64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    ThreadBuffer& local() {
+        // the buffers are owned by the tracer as well, so the events of the finished threads are dumped
+        thread_local std::shared_ptr<ThreadBuffer> buffer = [this] {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers.push_back(std::make_shared<ThreadBuffer>(bufferCapacity(), buffers.size() + 1));
+            return buffers.back();
+        }();
+        return *buffer;
+    }
+
+    // the recording is stopped and the mutex is held by the caller
+    void write() const {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            std::fprintf(stderr, "OPENVINO_TRACE_FILE: cannot open %s\n", path.c_str());
+            return;
+        }
+
+        const auto pid = getpid();
+        const char* separator = "\n";
+        file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        for (const auto& buffer : buffers) {
+            if (const char* name = buffer->name.load()) {
+                file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+                     << ",\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"" << escape(name) << "\"}}";
+                separator = ",\n";
+            }
+
+            const auto written = buffer->written.load(std::memory_order_relaxed);
+            const auto capacity = buffer->events.size();
+            // the tasks started before the beginning of the ring buffer have no begin event
+            size_t depth = 0;
+            for (auto i = written > capacity ? written - capacity : 0; i < written; i++) {
+                const auto& event = buffer->events[i % capacity];
+                if (!event.name && depth == 0)
+                    continue;
+                depth = event.name ? depth + 1 : depth - 1;
+
+                char ts[32];
+                std::snprintf(ts, sizeof(ts), "%.3f", event.ts / 1000.0);
+                file << separator << "{\"ph\":\"" << (event.name ? 'B' : 'E') << "\",\"pid\":" << pid
+                     << ",\"tid\":" << buffer->tid << ",\"ts\":" << ts;
+                if (event.name)
+                    file << ",\"name\":\"" << escape(event.name) << "\",\"cat\":\"" << escape(event.category) << "\"";
+                file << "}";
+                separator = ",\n";
+            }
+        }
+        file << "\n]}\n";
+    }
+
+    const std::chrono::steady_clock::time_point start;
+    std::string path;
+    std::atomic<bool> stopped{false};
+    std::mutex mutex;
+    std::unordered_set<std::string> strings;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+};
+
+}  // namespace
+
+bool enabled() {
+    static const bool enabled = Tracer::get().enabled();
+    return enabled;
+}
+
+const char* intern(const char* str) {
+    return Tracer::get().intern(str);
+}
+
+void begin(const char* category, const char* name) {
+    if (enabled())
+        Tracer::get().record(name, category);
+}
+
+void end() {
+    if (enabled())
+        Tracer::get().record(nullptr, nullptr);
+}
+
+void threadName(const char* name) {
+    if (enabled())
+        Tracer::get().setThreadName(name);
+}
+
+void flush() {
+    if (enabled())
+        Tracer::get().dump(true);
+}
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
+
+#endif  // ENABLE_PROFILING_TRACE
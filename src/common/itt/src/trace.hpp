@@ -0,0 +1,51 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief In-process tracer of the ITT tasks
+ * @file trace.hpp
+ */
+
+#pragma once
+
+namespace openvino {
+namespace itt {
+namespace trace {
+
+/**
+ * @brief Checks if the tracing is requested by the OPENVINO_TRACE_FILE environment variable
+ */
+bool enabled();
+
+/**
+ * @brief Returns the copy of the string which lives till the end of the process
+ */
+const char* intern(const char* str);
+
+/**
+ * @brief Records the beginning of the task in the ring buffer of the calling thread
+ * @param category The interned domain name
+ * @param name The interned task name
+ */
+void begin(const char* category, const char* name);
+
+/**
+ * @brief Records the end of the last task started by the calling thread
+ */
+void end();
+
+/**
+ * @brief Sets the name of the calling thread shown in the trace
+ */
+void threadName(const char* name);
+
+/**
+ * @brief Writes the recorded events to OPENVINO_TRACE_FILE, the events are written at the process exit as well.
+ * The recording is paused until the file is written, the events of the other threads at this time are dropped.
+ */
+void flush();
+
+}  // namespace trace
+}  // namespace itt
+}  // namespace openvino
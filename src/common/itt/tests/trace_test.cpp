@@ -0,0 +1,171 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "trace.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace openvino::itt;
+
+namespace {
+
+struct Event {
+    char phase;
+    std::string name;
+};
+
+struct Trace {
+    std::map<std::string, uint64_t> threads;
+    std::map<uint64_t, std::vector<Event>> events;
+};
+
+// the tracer reads the file name once, so it is set before the first use of the tracer
+const std::string& tracePath() {
+    static const std::string path = [] {
+        const std::string path = "ov_itt_trace_test.json";
+#ifdef _WIN32
+        _putenv_s("OPENVINO_TRACE_FILE", path.c_str());
+#else
+        setenv("OPENVINO_TRACE_FILE", path.c_str(), 1);
+#endif
+        return path;
+    }();
+    return path;
+}
+
+// every record of the trace is written on its own line
+Trace readTrace() {
+    const std::regex threadName(R"re(\{"name":"thread_name","ph":"M","pid":\d+,"tid":(\d+),"args":\{"name":"([^"]*)"\}\},?)re");
+    const std::regex event(
+        R"re(\{"ph":"([BE])","pid":\d+,"tid":(\d+),"ts":\d+\.\d{3}(,"name":"((?:[^"\\]|\\.)*)","cat":"([^"]*)")?\},?)re");
+
+    std::ifstream file(tracePath());
+    std::string line;
+    std::getline(file, line);
+    EXPECT_EQ(line, R"({"displayTimeUnit":"ns","traceEvents":[)");
+
+    Trace trace;
+    std::smatch match;
+    while (std::getline(file, line) && line != "]}") {
+        if (std::regex_match(line, match, threadName)) {
+            trace.threads[match[2]] = std::stoull(match[1]);
+        } else if (std::regex_match(line, match, event)) {
+            const char phase = match[1].str()[0];
+            EXPECT_EQ(phase == 'B', match[3].matched) << line;
+            trace.events[std::stoull(match[2])].push_back({phase, match[4]});
+        } else {
+            ADD_FAILURE() << "Unexpected record: " << line;
+        }
+    }
+    EXPECT_EQ(line, "]}");
+    EXPECT_FALSE(std::getline(file, line));
+    return trace;
+}
+
+class TraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        tracePath();
+        ASSERT_TRUE(trace::enabled());
+        category = trace::intern("test");
+    }
+
+    void TearDown() override {
+        std::remove(tracePath().c_str());
+    }
+
+    const char* category = nullptr;
+};
+
+}  // namespace
+
+TEST_F(TraceTest, ScopesOfSeveralThreads) {
+    const size_t threadsNum = 4;
+    const size_t scopesNum = 100;
+    const char* outer = trace::intern("outer");
+    const char* inner = trace::intern("inner \"quoted\"");
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t] {
+            trace::threadName(("scopes_" + std::to_string(t)).c_str());
+            for (size_t i = 0; i < scopesNum; i++) {
+                trace::begin(category, outer);
+                trace::begin(category, inner);
+                trace::end();
+                trace::end();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    trace::flush();
+
+    auto trace = readTrace();
+    for (size_t t = 0; t < threadsNum; t++) {
+        const auto name = "scopes_" + std::to_string(t);
+        ASSERT_EQ(trace.threads.count(name), 1) << name;
+        const auto& events = trace.events[trace.threads[name]];
+        ASSERT_EQ(events.size(), 4 * scopesNum) << name;
+        for (size_t i = 0; i < events.size(); i += 4) {
+            ASSERT_EQ(events[i].phase, 'B');
+            ASSERT_EQ(events[i].name, "outer");
+            ASSERT_EQ(events[i + 1].phase, 'B');
+            ASSERT_EQ(events[i + 1].name, R"(inner \"quoted\")");
+            ASSERT_EQ(events[i + 2].phase, 'E');
+            ASSERT_EQ(events[i + 3].phase, 'E');
+        }
+    }
+}
+
+TEST_F(TraceTest, FlushWhileRecording) {
+    const size_t threadsNum = 4;
+    const char* scope = trace::intern("scope");
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> started{0};
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadsNum; t++) {
+        threads.emplace_back([&, t] {
+            trace::threadName(("recording_" + std::to_string(t)).c_str());
+            for (size_t i = 0; !stop; i++) {
+                trace::begin(category, scope);
+                trace::end();
+                if (i == 100)
+                    started++;
+            }
+        });
+    }
+    while (started < threadsNum)
+        std::this_thread::yield();
+    trace::flush();
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+
+    // the events of the threads are consistent: a dropped or an overwritten begin is not followed by its end
+    auto trace = readTrace();
+    for (size_t t = 0; t < threadsNum; t++) {
+        const auto name = "recording_" + std::to_string(t);
+        ASSERT_EQ(trace.threads.count(name), 1) << name;
+        const auto& events = trace.events[trace.threads[name]];
+        ASSERT_FALSE(events.empty()) << name;
+        int depth = 0;
+        for (const auto& event : events) {
+            depth += event.phase == 'B' ? 1 : -1;
+            ASSERT_GE(depth, 0) << name;
+            ASSERT_LE(depth, 1) << name;
+        }
+    }
+}
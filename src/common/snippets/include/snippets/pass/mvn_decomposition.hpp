@@ -0,0 +1,31 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface MVNDecomposition
+ * @brief The pass decomposes MVN over the last dimension into explicit Snippets dialects:
+ *        the Loop with ReduceSum for mean, the Loop with ReduceSum of squared differences for variance (if normalize_variance is set)
+ *        and the Loop with normalization. Mean and reciprocal standard deviation are calculated outside Loops.
+ *        Note:
+ *            - At the moment Snippets supports MVN only with static shapes where there are Buffer ops before and after MVN
+ *              because the input data is read several times
+ * @ingroup snippets
+ */
+class MVNDecomposition: public ngraph::pass::MatcherPass {
+public:
+    explicit MVNDecomposition(const size_t vector_size);
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
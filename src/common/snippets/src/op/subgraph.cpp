@@ -22,6 +22,7 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/softmax_decomposition.hpp"
+#include "snippets/pass/mvn_decomposition.hpp"
 #include "snippets/pass/reset_buffer.hpp"
 #include "snippets/pass/insert_buffer.hpp"
 #include "snippets/pass/loop_fusion.hpp"
@@ -70,6 +71,7 @@ void snippets::op::Subgraph::init_config() {
             ov::is_type<ov::op::v1::Transpose>(op) ||
             ov::is_type<ov::op::v1::Softmax>(op) ||
             ov::is_type<ov::op::v8::Softmax>(op) ||
+            ov::is_type<ov::op::v6::MVN>(op) ||
             ov::is_type<ov::op::v0::MatMul>(op);
     }
     // Domain sensitive ops are decomposed with explicit Loops. So, we should explicitly insert Loops in Subgraph if it contains these ops
@@ -205,7 +207,8 @@ auto snippets::op::Subgraph::wrap_node_as_subgraph(const std::shared_ptr<ov::Nod
         hidden_data_count += utils::get_non_scalar_constant_count_for_fq(fq_node);
     // Ops that requires Buffer
     } else if (ov::is_type<ov::op::v1::Softmax>(node) ||
-               ov::is_type<ov::op::v8::Softmax>(node)) {
+               ov::is_type<ov::op::v8::Softmax>(node) ||
+               ov::is_type<ov::op::v6::MVN>(node)) {
         need_buffer |= true;
     }
     subgraph->set_virtual_port_count(hidden_data_count);
@@ -239,6 +242,7 @@ auto snippets::op::Subgraph::constant_input_should_be_inside_body(const std::sha
     return ov::is_type<ov::op::v1::Transpose>(node) ||
            ov::is_type<ov::op::v1::Broadcast>(node) ||
            ov::is_type<ov::op::v3::Broadcast>(node) ||
+           ov::is_type<ov::op::v6::MVN>(node) ||
            ov::is_type<ov::op::v1::Reshape>(node);
 }
 
@@ -543,6 +547,7 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
         manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         manager.register_pass<snippets::pass::InsertBuffer>(allocationRank);
         manager.register_pass<snippets::pass::SoftmaxDecomposition>(count, allocationRank);
+        manager.register_pass<snippets::pass::MVNDecomposition>(count);
         manager.register_pass<snippets::pass::TransposeDecomposition>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
@@ -21,7 +21,7 @@ inline auto is_in_op(const std::shared_ptr<ov::Node>& n) -> bool {
 }
 
 // At the moment Subgraph supports only Eltwise, Select, Convert, Broadcast and FQ (which is decomposed into Eltwises and Convert) with
-// Softmax (which is decomposed into Eltwises as well)
+// Softmax and MVN (which are decomposed into Eltwises as well)
 // And only Eltwise and Select ops supports execution only in "exec_type". So we can check op type from the opposite
 // NOTE: This check is only for executable which isn't Parameter/Constant/Result
 inline auto op_supports_only_exec_type(const std::shared_ptr<ov::Node>& n) -> bool {
@@ -142,6 +142,19 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
         return axis >= 0 && axis == (rank.get_length() - 1);
     };
 
+    auto is_supported_mvn = [](const std::shared_ptr<const Node> &n) -> bool {
+        // MVN is decomposed into Loops over the last dimension, so only normalization over the last axis is supported
+        const auto mvn = ov::as_type_ptr<const ov::op::v6::MVN>(n);
+        if (!mvn || n->get_input_partial_shape(0).is_dynamic())
+            return false;
+        const auto axes = as_type_ptr<const opset1::Constant>(n->get_input_node_shared_ptr(1));
+        if (!axes)
+            return false;
+        const auto rank = n->get_input_partial_shape(0).rank();
+        const auto axes_value = ngraph::normalize_axes(n->get_friendly_name(), axes->cast_vector<int64_t>(), rank);
+        return axes_value.size() == 1 && axes_value[0] == static_cast<size_t>(rank.get_length() - 1);
+    };
+
     auto is_supported_broadcast_op = [](const std::shared_ptr<const Node> &n) -> bool {
         // Broadcast is supported only for MHA tokenization where there are needed and special checks
         if (auto broadcast_v1 = ov::as_type_ptr<const ov::op::v1::Broadcast>(n)) {
@@ -158,15 +171,29 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           is_supported_mvn(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
 
+auto is_shape_agnostic_op(const std::shared_ptr<const Node> &n) -> bool {
+    // The kernel is generated by plugin for the actual input shapes, so only the operations which don't
+    // change shapes can have dynamic dimensions. Shape-changing operations and FakeQuantize (its decomposition
+    // relies on static constant shapes) are still limited to static shapes
+    return !ov::is_type<const opset1::MatMul>(n) &&
+           !ov::is_type<const opset1::Transpose>(n) &&
+           !ov::is_type<const ov::op::v1::Broadcast>(n) &&
+           !ov::is_type<const ov::op::v3::Broadcast>(n) &&
+           !ov::is_type<const opset1::FakeQuantize>(n);
+}
+
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
-    auto supported = [&n](descriptor::Tensor& t) -> bool {
+    const bool dynamic_shapes_allowed = is_shape_agnostic_op(n);
+    auto supported = [&n, dynamic_shapes_allowed](descriptor::Tensor& t) -> bool {
+        const auto& pshape = t.get_partial_shape();
         // Todo: int32 isn't supported in general because i32 emitters are required for bit-exact i32 calculations in some cases
         //  So i32 is supported exclusively for transposes and broadcast
-        return t.get_partial_shape().is_static() &&
+        return (pshape.is_static() || (dynamic_shapes_allowed && pshape.rank().is_static())) &&
                (TokenizeSnippets::supported_element_types.count(t.get_element_type()) != 0 ||
                 (t.get_element_type() == ngraph::element::i32 &&
                         (ov::is_type<const opset1::Transpose>(n) ||
@@ -182,7 +209,11 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // MVN axes are used only to decompose MVN and aren't scheduled, so their element type doesn't matter
+    auto is_mvn_axes = [&n](const Input<const Node>& in) {
+        return ov::is_type<const ov::op::v6::MVN>(n) && in.get_index() == 1;
+    };
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  is_mvn_axes(in) || supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -504,7 +535,8 @@ TokenizeSnippets::TokenizeSnippets() {
             hidden_data_count += ngraph::snippets::utils::get_non_scalar_constant_count_for_fq(fq_node);
         // Ops require a Buffer
         } else if (ov::is_type<ov::op::v1::Softmax>(node) ||
-                   ov::is_type<ov::op::v8::Softmax>(node)) {
+                   ov::is_type<ov::op::v8::Softmax>(node) ||
+                   ov::is_type<ov::op::v6::MVN>(node)) {
             need_buffer |= true;
         }
 
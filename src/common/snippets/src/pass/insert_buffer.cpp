@@ -16,6 +16,7 @@ ngraph::snippets::pass::InsertBuffer::InsertBuffer(const int32_t allocation_rank
     // The list of operations that require Buffers on their Inputs and Outputs
     const auto pattern = ngraph::pattern::wrap_type<ngraph::op::v1::Softmax,
                                                     ngraph::op::v8::Softmax,
+                                                    ngraph::op::v6::MVN,
                                                     ngraph::op::v1::Transpose,
                                                     op::Brgemm>();
 
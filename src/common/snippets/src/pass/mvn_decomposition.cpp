@@ -0,0 +1,203 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/remarks.hpp"
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/mvn_decomposition.hpp"
+#include "snippets/pass/reset_buffer.hpp"
+#include "snippets/pass/insert_loops.hpp"
+#include "snippets/pass/loop_helpers.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/validation_util.hpp>
+
+
+ngraph::snippets::pass::MVNDecomposition::MVNDecomposition(const size_t vector_size) {
+    MATCHER_SCOPE(MVNDecomposition);
+
+    auto m_mvn = ngraph::pattern::wrap_type<ov::op::v6::MVN>();
+
+    auto callback = [=](ngraph::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::MVNDecomposition")
+        const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(m.get_match_root());
+        const auto master_pshape = mvn->get_input_partial_shape(0);
+        const auto rank = master_pshape.rank();
+        if (rank.is_dynamic() || master_pshape.is_dynamic())
+            return false;
+
+        const auto axes_constant = ov::as_type_ptr<ov::op::v0::Constant>(mvn->get_input_node_shared_ptr(1));
+        if (!axes_constant)
+            return false;
+        const auto shape_rank = rank.get_length();
+        const auto axes = ngraph::normalize_axes(mvn->get_friendly_name(), axes_constant->cast_vector<int64_t>(), rank);
+        if (axes.size() != 1 || axes[0] != static_cast<size_t>(shape_rank - 1))
+            return false;
+
+        const auto data = mvn->input_value(0);
+        const auto data_shape = data.get_shape();
+
+        const auto master_shape = master_pshape.get_shape();
+        const auto inner_dim = shape_rank - 1;
+        const auto work_amount = master_shape[inner_dim];
+        const auto increment = vector_size;
+        const int outer_dim = shape_rank > 1 ? static_cast<int>(shape_rank - 2) : -1;
+        const auto has_outer_loop = outer_dim >= 0 && master_shape[outer_dim] > 1;
+        const auto normalize_variance = mvn->get_normalize_variance();
+
+        // Input data is read by every Loop, so data pointer is propagated through Loops[ReduceSum] using fake edges
+        // as in SoftmaxDecomposition and always reset after these Loops
+        auto reduce_apply_increments = InsertLoops::calculate_inner_apply_increments(master_shape, {data_shape, data_shape, data_shape});
+        reduce_apply_increments[0] = false;
+        reduce_apply_increments[1] = false;
+        const auto reduce_finalization_offsets =
+            std::vector<int64_t>{ 0, 0, ResetBufferState::calculate_required_finalization_offsets(work_amount, data_shape[inner_dim]) };
+
+        const auto reciprocal_work_amount = ngraph::op::Constant::create(ov::element::f32, ngraph::Shape{}, {1.f / static_cast<float>(work_amount)});
+
+        /* ========== ReduceSum decomposition ========= */
+
+        const auto vector_buffer_mean = std::make_shared<ngraph::snippets::op::VectorBuffer>();
+        const auto loop_mean_begin = ngraph::snippets::op::insertLoopBegin(ngraph::OutputVector{data, data});
+
+        const auto load_mean = std::make_shared<ngraph::snippets::op::Load>(loop_mean_begin->output(0), increment);
+        const auto sum_mean = std::make_shared<ov::op::v1::Add>(load_mean, vector_buffer_mean);
+
+        const auto loop_mean_end = std::make_shared<ngraph::snippets::op::LoopEnd>(
+            ngraph::OutputVector{loop_mean_begin->output(1), loop_mean_begin->output(2)}, work_amount, increment,
+            reduce_apply_increments, reduce_finalization_offsets);
+
+        const auto horizon_mean = std::make_shared<ngraph::snippets::op::HorizonSum>(sum_mean);
+        const auto mean = std::make_shared<ov::op::v1::Multiply>(horizon_mean, reciprocal_work_amount);
+
+        ov::NodeVector ops_outside_loop = { reciprocal_work_amount, vector_buffer_mean, horizon_mean, mean };
+        ov::NodeVector decomposition = { reciprocal_work_amount, vector_buffer_mean, loop_mean_begin, load_mean, sum_mean,
+                                         loop_mean_end, horizon_mean, mean };
+
+        loop_mean_begin->add_control_dependency(vector_buffer_mean);
+        loop_mean_end->add_control_dependency(sum_mean);
+        horizon_mean->add_control_dependency(loop_mean_end);
+
+        // For tail loop we should fill input of Sum by zero to avoid math incorrect calculations
+        sum_mean->input(0).get_rt_info()["set_fill"] = uint32_t(0x00000000);
+
+        /* =========================================== */
+
+        /* ====== Variance + ReduceSum decomposition ====== */
+
+        ov::Output<ov::Node> normalization_input = loop_mean_end->output(0);
+        std::shared_ptr<ov::Node> rstd = nullptr;
+        if (normalize_variance) {
+            const auto vector_buffer_var = std::make_shared<ngraph::snippets::op::VectorBuffer>();
+            const auto loop_var_begin = ngraph::snippets::op::insertLoopBegin(ngraph::OutputVector{loop_mean_end->output(0), loop_mean_end->output(0)});
+
+            const auto load_var = std::make_shared<ngraph::snippets::op::Load>(loop_var_begin->output(0), increment);
+            const auto sqr_diff = std::make_shared<ov::op::v0::SquaredDifference>(load_var, mean);
+            const auto sum_var = std::make_shared<ov::op::v1::Add>(sqr_diff, vector_buffer_var);
+
+            const auto loop_var_end = std::make_shared<ngraph::snippets::op::LoopEnd>(
+                ngraph::OutputVector{loop_var_begin->output(1), loop_var_begin->output(2)}, work_amount, increment,
+                reduce_apply_increments, reduce_finalization_offsets);
+
+            const auto horizon_var = std::make_shared<ngraph::snippets::op::HorizonSum>(sum_var);
+            const auto variance = std::make_shared<ov::op::v1::Multiply>(horizon_var, reciprocal_work_amount);
+
+            // Divide is expensive operation, so we calculate reciprocal standard deviation outside loop and multiply by it
+            const auto eps = ngraph::op::Constant::create(ov::element::f32, ngraph::Shape{}, {mvn->get_eps()});
+            ov::NodeVector rstd_ops;
+            if (mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+                const auto add_eps = std::make_shared<ov::op::v1::Add>(variance, eps);
+                rstd = std::make_shared<ngraph::opset1::Power>(add_eps,
+                    ngraph::op::Constant::create(ov::element::f32, ngraph::Shape{}, {-0.5f}));
+                rstd_ops = { eps, add_eps, rstd };
+            } else {
+                const auto std_dev = std::make_shared<ov::op::v0::Sqrt>(variance);
+                const auto add_eps = std::make_shared<ov::op::v1::Add>(std_dev, eps);
+                rstd = std::make_shared<ngraph::opset1::Power>(add_eps,
+                    ngraph::op::Constant::create(ov::element::f32, ngraph::Shape{}, {-1}));
+                rstd_ops = { eps, std_dev, add_eps, rstd };
+            }
+
+            loop_var_begin->add_control_dependency(vector_buffer_var);
+            loop_var_begin->add_control_dependency(mean);
+            loop_var_end->add_control_dependency(sum_var);
+            horizon_var->add_control_dependency(loop_var_end);
+
+            sum_var->input(0).get_rt_info()["set_fill"] = uint32_t(0x00000000);
+
+            ops_outside_loop.insert(ops_outside_loop.end(), { vector_buffer_var, horizon_var, variance });
+            ops_outside_loop.insert(ops_outside_loop.end(), rstd_ops.begin(), rstd_ops.end());
+            decomposition.insert(decomposition.end(), { vector_buffer_var, loop_var_begin, load_var, sqr_diff, sum_var, loop_var_end,
+                                                        horizon_var, variance });
+            decomposition.insert(decomposition.end(), rstd_ops.begin(), rstd_ops.end());
+
+            normalization_input = loop_var_end->output(0);
+        }
+
+        /* =========================================== */
+
+        /* ============== Normalization ============== */
+
+        const auto loop_norm_begin = ngraph::snippets::op::insertLoopBegin(ngraph::OutputVector{normalization_input});
+
+        const auto load_norm = std::make_shared<ngraph::snippets::op::Load>(loop_norm_begin->output(0), increment);
+        std::shared_ptr<ov::Node> norm = std::make_shared<ov::op::v1::Subtract>(load_norm, mean);
+        decomposition.insert(decomposition.end(), { loop_norm_begin, load_norm, norm });
+        if (rstd) {
+            norm = std::make_shared<ov::op::v1::Multiply>(norm, rstd);
+            decomposition.push_back(norm);
+        }
+        const auto store_norm = std::make_shared<ngraph::snippets::op::Store>(norm, increment);
+
+        auto apply_increments_norm =
+                InsertLoops::calculate_inner_apply_increments(master_shape, {load_norm->get_shape(), store_norm->get_shape()});
+        std::vector<int64_t> finalization_offsets_norm(2, 0);
+        if (has_outer_loop) {
+            finalization_offsets_norm =
+                InsertLoops::calculate_finalization_offsets(master_shape, {load_norm->get_shape(), store_norm->get_shape()});
+        }
+        const auto loop_norm_end = std::make_shared<ngraph::snippets::op::LoopEnd>(
+            ngraph::OutputVector{store_norm, loop_norm_begin->output(1)}, work_amount, increment,
+            apply_increments_norm, finalization_offsets_norm);
+        decomposition.insert(decomposition.end(), { store_norm, loop_norm_end });
+
+        loop_norm_begin->add_control_dependency(mean);
+        if (rstd)
+            loop_norm_begin->add_control_dependency(rstd);
+
+        /* =========================================== */
+
+        for (const auto& op : ops_outside_loop) {
+            op->get_rt_info()["outside_loop"] = true;
+        }
+        ngraph::copy_runtime_info(mvn, decomposition);
+
+        ngraph::replace_node(mvn, loop_norm_end);
+
+        /* ============== Outer loop ================= */
+        if (has_outer_loop) {
+            std::vector<bool> apply_increments =
+                    InsertLoops::calculate_outer_apply_increments({mvn->get_input_shape(0), mvn->get_output_shape(0)});
+            const auto mvn_parameters = std::vector<ov::Output<ov::Node>>{loop_mean_begin->input(0).get_source_output()};
+            const auto output_set = loop_norm_end->output(0).get_target_inputs();
+            const auto mvn_results = std::vector<ov::Input<ov::Node>>{output_set.begin(), output_set.end()};
+            const auto& outer_loop_begin = ngraph::snippets::op::insertLoopBegin(mvn_parameters);
+            const auto outer_loop_end = ngraph::snippets::op::insertLoopEndBeforeInputs(
+                mvn_results, outer_loop_begin, master_shape[outer_dim], 1, apply_increments);
+
+            vector_buffer_mean->add_control_dependency(outer_loop_begin);
+
+            ngraph::copy_runtime_info(mvn, {outer_loop_begin, outer_loop_end});
+        }
+        /* =========================================== */
+
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_mvn, matcher_name);
+    register_matcher(m, callback);
+}
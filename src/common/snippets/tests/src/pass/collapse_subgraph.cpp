@@ -6,6 +6,8 @@
 #include <pass/collapse_subgraph.hpp>
 #include <subgraph_simple.hpp>
 #include <subgraph_converts.hpp>
+#include <subgraph_matmul.hpp>
+#include <subgraph_mvn.hpp>
 #include "snippets/pass/tokenization.hpp"
 
 namespace ov {
@@ -31,6 +33,20 @@ TEST_F(CollapseSubgraphTests, smoke_Snippets_Eltwise) {
     run();
 }
 
+TEST_F(CollapseSubgraphTests, smoke_Snippets_EltwiseDynamic) {
+    const auto &f = AddFunction(std::vector<PartialShape> {{-1, -1, 16}, {1, -1, 16}});
+    function = f.getOriginal();
+    function_ref = f.getReference();
+    run();
+}
+
+TEST_F(CollapseSubgraphTests, smoke_Snippets_MatMulDynamicIsNotTokenized) {
+    const auto &f = MatMulFunction(std::vector<PartialShape> {{-1, 3, 4, 4}, {-1, 3, 4, 4}});
+    function = f.getOriginal();
+    manager.register_pass<ngraph::snippets::pass::EnumerateNodes>();
+    manager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+}
+
 TEST_F(CollapseSubgraphTests, smoke_Snippets_MatMulWithEltwise) {
     const auto &f = MatMulEltwiseBranchesFunction(std::vector<PartialShape> {{1, 3, 4, 4}, {1, 3, 4, 4}});
     function = f.getOriginal();
@@ -38,6 +54,13 @@ TEST_F(CollapseSubgraphTests, smoke_Snippets_MatMulWithEltwise) {
     run();
 }
 
+TEST_F(CollapseSubgraphTests, smoke_Snippets_AddMVN) {
+    const auto &f = AddMVNFunction(std::vector<PartialShape> {{1, 4, 16, 35}, {1, 4, 16, 35}}, true, ov::op::MVNEpsMode::INSIDE_SQRT);
+    function = f.getOriginal();
+    function_ref = f.getReference();
+    run();
+}
+
 TEST_F(CollapseSubgraphTests, smoke_Snippets_AvoidLoopEltwise) {
     const auto &f = EltwiseLogLoopFunction(std::vector<PartialShape> {{2, 5}, {2, 1}});
     function = f.getOriginal();
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the lossless compression of the constant data stored in the IR weights file
+ * @file weights_compression.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Lossless compression of the constant data: the bytes of the elements are shuffled, so the bytes of
+ * the same significance (e.g. exponents of floating point values) go one by one, then the result is compressed
+ * by LZ77 algorithm. The data is split into the chunks which are compressed independently, so they can be
+ * decompressed in parallel directly into the destination buffer.
+ *
+ * The sub-byte types (u4, i4, u1) are already bit-packed in the constant, they are compressed without shuffling.
+ */
+namespace weights_compression {
+
+/// @brief Name of the compression scheme stored in the IR
+constexpr const char* scheme_name = "shuffle_lz";
+
+/**
+ * @brief Compresses the data
+ * @param data Data to be compressed
+ * @param size Size of the data in bytes
+ * @param element_size Size of the element in bytes, the data is not shuffled if it is 1
+ * @return Compressed data including the header with the description of the chunks
+ */
+std::vector<char> compress(const char* data, size_t size, size_t element_size);
+
+/**
+ * @brief Returns the number of independently compressed chunks, throws std::runtime_error if the header is corrupted
+ * @param src Compressed data
+ * @param src_size Size of the compressed data in bytes
+ * @param dst_size Expected size of the decompressed data in bytes
+ */
+size_t get_chunks_num(const char* src, size_t src_size, size_t dst_size);
+
+/**
+ * @brief Decompresses one chunk into its place in the destination buffer. Different chunks can be
+ * decompressed concurrently. Throws std::runtime_error if the compressed data is corrupted.
+ * @param src Compressed data
+ * @param src_size Size of the compressed data in bytes
+ * @param chunk Index of the chunk
+ * @param dst Destination buffer for the whole decompressed data
+ * @param dst_size Size of the destination buffer in bytes
+ */
+void decompress_chunk(const char* src, size_t src_size, size_t chunk, char* dst, size_t dst_size);
+
+}  // namespace weights_compression
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,260 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/weights_compression.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+// Compressed data layout:
+//     uint64_t raw_size, chunk_size, element_size, chunks_num
+//     uint64_t chunk_end[chunks_num]   - end of the compressed chunk relative to the beginning of the chunks
+//     compressed chunks
+//
+// Compressed chunk is a sequence of LZ77 blocks:
+//     token            - high 4 bits are the number of literals, low 4 bits are the match length minus min_match,
+//                        15 means that the length is continued by the following bytes
+//     literals length  - bytes to be added to the number of literals while the byte is 255
+//     literals
+//     offset           - 2 bytes, distance to the match, absent in the last block
+//     match length     - bytes to be added to the match length while the byte is 255
+constexpr size_t header_fields = 4;
+constexpr size_t default_chunk_size = 1 << 20;
+constexpr size_t min_match = 4;
+constexpr size_t max_offset = 0xFFFF;
+constexpr size_t hash_bits = 14;
+
+void write_u64(std::vector<char>& dst, size_t pos, uint64_t value) {
+    std::memcpy(dst.data() + pos, &value, sizeof(value));
+}
+
+uint64_t read_u64(const char* src) {
+    uint64_t value = 0;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+uint32_t read_u32(const uint8_t* src) {
+    uint32_t value = 0;
+    std::memcpy(&value, src, sizeof(value));
+    return value;
+}
+
+void corrupted() {
+    throw std::runtime_error("Compressed weights are corrupted");
+}
+
+void shuffle(const char* src, size_t size, size_t element_size, char* dst) {
+    const size_t elements = size / element_size;
+    for (size_t b = 0; b < element_size; ++b) {
+        for (size_t e = 0; e < elements; ++e)
+            dst[b * elements + e] = src[e * element_size + b];
+    }
+    std::copy(src + elements * element_size, src + size, dst + elements * element_size);
+}
+
+void unshuffle(const char* src, size_t size, size_t element_size, char* dst) {
+    const size_t elements = size / element_size;
+    for (size_t b = 0; b < element_size; ++b) {
+        for (size_t e = 0; e < elements; ++e)
+            dst[e * element_size + b] = src[b * elements + e];
+    }
+    std::copy(src + elements * element_size, src + size, dst + elements * element_size);
+}
+
+void write_length(std::vector<char>& dst, size_t length) {
+    for (; length >= 255; length -= 255)
+        dst.push_back(static_cast<char>(255));
+    dst.push_back(static_cast<char>(length));
+}
+
+void write_block(std::vector<char>& dst,
+                 const uint8_t* literals,
+                 size_t literals_num,
+                 size_t offset,
+                 size_t match_length) {
+    const size_t literals_token = std::min<size_t>(literals_num, 15);
+    const size_t match_token = offset ? std::min<size_t>(match_length - min_match, 15) : 0;
+    dst.push_back(static_cast<char>((literals_token << 4) | match_token));
+    if (literals_token == 15)
+        write_length(dst, literals_num - 15);
+    dst.insert(dst.end(), literals, literals + literals_num);
+    if (offset) {
+        dst.push_back(static_cast<char>(offset & 0xFF));
+        dst.push_back(static_cast<char>(offset >> 8));
+        if (match_token == 15)
+            write_length(dst, match_length - min_match - 15);
+    }
+}
+
+void lz_compress(const uint8_t* src, size_t size, std::vector<char>& dst) {
+    std::vector<int64_t> table(size_t{1} << hash_bits, -1);
+    size_t anchor = 0, pos = 0;
+    while (pos + min_match <= size) {
+        const uint32_t sequence = read_u32(src + pos);
+        const size_t hash = (sequence * 2654435761u) >> (32 - hash_bits);
+        const int64_t candidate = table[hash];
+        table[hash] = static_cast<int64_t>(pos);
+        if (candidate >= 0 && pos - candidate <= max_offset && read_u32(src + candidate) == sequence) {
+            size_t length = min_match;
+            while (pos + length < size && src[candidate + length] == src[pos + length])
+                ++length;
+            write_block(dst, src + anchor, pos - anchor, pos - candidate, length);
+            pos += length;
+            anchor = pos;
+        } else {
+            // incompressible data is skipped faster
+            pos += 1 + ((pos - anchor) >> 6);
+        }
+    }
+    if (anchor < size)
+        write_block(dst, src + anchor, size - anchor, 0, 0);
+}
+
+size_t read_length(const uint8_t*& src, const uint8_t* src_end, size_t length) {
+    if (length != 15)
+        return length;
+    uint8_t byte = 0;
+    do {
+        if (src == src_end)
+            corrupted();
+        byte = *src++;
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+void lz_decompress(const uint8_t* src, size_t src_size, uint8_t* dst, size_t dst_size) {
+    const uint8_t* src_end = src + src_size;
+    size_t pos = 0;
+    while (src < src_end) {
+        const uint8_t token = *src++;
+        const size_t literals_num = read_length(src, src_end, token >> 4);
+        if (literals_num > static_cast<size_t>(src_end - src) || literals_num > dst_size - pos)
+            corrupted();
+        std::memcpy(dst + pos, src, literals_num);
+        src += literals_num;
+        pos += literals_num;
+        if (src == src_end)
+            break;
+
+        if (src_end - src < 2)
+            corrupted();
+        const size_t offset = src[0] | (static_cast<size_t>(src[1]) << 8);
+        src += 2;
+        const size_t length = read_length(src, src_end, token & 0xF) + min_match;
+        if (offset == 0 || offset > pos || length > dst_size - pos)
+            corrupted();
+        const uint8_t* match = dst + pos - offset;
+        if (offset >= length) {
+            std::memcpy(dst + pos, match, length);
+        } else {
+            // overlapped match repeats the last offset bytes
+            for (size_t i = 0; i < length; ++i)
+                dst[pos + i] = match[i];
+        }
+        pos += length;
+    }
+    if (pos != dst_size)
+        corrupted();
+}
+
+struct Header {
+    uint64_t raw_size, chunk_size, element_size, chunks_num;
+    const char* chunk_end;
+    const char* chunks;
+    size_t chunks_size;
+};
+
+Header read_header(const char* src, size_t src_size, size_t dst_size) {
+    if (src_size < header_fields * sizeof(uint64_t))
+        corrupted();
+    Header header{read_u64(src),
+                  read_u64(src + sizeof(uint64_t)),
+                  read_u64(src + 2 * sizeof(uint64_t)),
+                  read_u64(src + 3 * sizeof(uint64_t)),
+                  nullptr,
+                  nullptr,
+                  0};
+    if (header.raw_size != dst_size || header.chunk_size == 0 || header.element_size == 0 ||
+        header.chunks_num > src_size / sizeof(uint64_t))
+        corrupted();
+    // the chunks cover the data exactly: all chunks except the last one are full, checked without overflow
+    if (header.raw_size == 0) {
+        if (header.chunks_num != 0)
+            corrupted();
+    } else if (header.chunk_size > header.raw_size || header.chunks_num == 0 ||
+               header.chunks_num - 1 != (header.raw_size - 1) / header.chunk_size) {
+        corrupted();
+    }
+    const size_t header_size = (header_fields + header.chunks_num) * sizeof(uint64_t);
+    if (header_size > src_size)
+        corrupted();
+    header.chunk_end = src + header_fields * sizeof(uint64_t);
+    header.chunks = src + header_size;
+    header.chunks_size = src_size - header_size;
+    return header;
+}
+}  // namespace
+
+std::vector<char> ov::util::weights_compression::compress(const char* data, size_t size, size_t element_size) {
+    element_size = std::max<size_t>(element_size, 1);
+    // the chunk contains the whole number of elements, the only chunk of the small data has its size
+    const size_t chunk_size =
+        std::max(std::min(std::max(default_chunk_size / element_size, size_t{1}) * element_size, size), size_t{1});
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+
+    std::vector<char> dst((header_fields + chunks_num) * sizeof(uint64_t));
+    write_u64(dst, 0, size);
+    write_u64(dst, sizeof(uint64_t), chunk_size);
+    write_u64(dst, 2 * sizeof(uint64_t), element_size);
+    write_u64(dst, 3 * sizeof(uint64_t), chunks_num);
+
+    const size_t chunks_begin = dst.size();
+    std::vector<char> shuffled(element_size > 1 ? std::min(chunk_size, size) : 0);
+    for (size_t chunk = 0; chunk < chunks_num; ++chunk) {
+        const size_t raw_begin = chunk * chunk_size;
+        const size_t raw_size = std::min(chunk_size, size - raw_begin);
+        const char* raw = data + raw_begin;
+        if (element_size > 1) {
+            shuffle(raw, raw_size, element_size, shuffled.data());
+            raw = shuffled.data();
+        }
+        lz_compress(reinterpret_cast<const uint8_t*>(raw), raw_size, dst);
+        write_u64(dst, (header_fields + chunk) * sizeof(uint64_t), dst.size() - chunks_begin);
+    }
+    return dst;
+}
+
+size_t ov::util::weights_compression::get_chunks_num(const char* src, size_t src_size, size_t dst_size) {
+    return static_cast<size_t>(read_header(src, src_size, dst_size).chunks_num);
+}
+
+void ov::util::weights_compression::decompress_chunk(const char* src,
+                                                     size_t src_size,
+                                                     size_t chunk,
+                                                     char* dst,
+                                                     size_t dst_size) {
+    const auto header = read_header(src, src_size, dst_size);
+    if (chunk >= header.chunks_num)
+        corrupted();
+    const uint64_t begin = chunk == 0 ? 0 : read_u64(header.chunk_end + (chunk - 1) * sizeof(uint64_t));
+    const uint64_t end = read_u64(header.chunk_end + chunk * sizeof(uint64_t));
+    if (begin > end || end > header.chunks_size)
+        corrupted();
+
+    const size_t raw_begin = chunk * header.chunk_size;
+    const size_t raw_size = std::min<size_t>(header.chunk_size, dst_size - raw_begin);
+    const auto compressed = reinterpret_cast<const uint8_t*>(header.chunks + begin);
+    if (header.element_size == 1) {
+        lz_decompress(compressed, end - begin, reinterpret_cast<uint8_t*>(dst + raw_begin), raw_size);
+    } else {
+        std::vector<char> shuffled(raw_size);
+        lz_decompress(compressed, end - begin, reinterpret_cast<uint8_t*>(shuffled.data()), raw_size);
+        unshuffle(shuffled.data(), raw_size, header.element_size, dst + raw_begin);
+    }
+}
@@ -48,6 +48,13 @@ public:
               Version version = Version::UNSPECIFIED);
     Serialize(const std::string& xmlPath, const std::string& binPath, Version version = Version::UNSPECIFIED);
 
+    /**
+     * @brief Enables the compression of the constant data
+     * @param compress_weights If true, the constant data is stored in the bin file compressed when it reduces
+     * the size, the compression scheme is recorded in the xml file and the data is decompressed by the IR frontend
+     */
+    void set_compress_weights(bool compress_weights);
+
 private:
     std::ostream* m_xmlFile;
     std::ostream* m_binFile;
@@ -55,6 +62,7 @@ private:
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    bool m_compress_weights = false;
 };
 
 /**
@@ -20,6 +20,7 @@
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/weights_compression.hpp"
 #include "pugixml.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -83,19 +84,23 @@ class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
-    using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    struct StoredData {
+        FilePosition offset;
+        size_t size;
+        bool compressed;
+    };
+    using ConstWritePositions = std::unordered_map<HashValue, std::pair<StoredData, void const*>>;
+
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool compress_weights = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_compress_weights(compress_weights),
           m_blob_offset(bin_data.tellp()) {}
 
-    FilePosition write(const char* ptr, size_t size) {
-        const FilePosition write_pos = m_binary_output.tellp();
-        const auto offset = write_pos - m_blob_offset;
+    StoredData write(const char* ptr, size_t size, size_t element_size = 1) {
         if (!m_enable_compression) {
-            m_binary_output.write(ptr, size);
-            return offset;
+            return store(ptr, size, element_size);
         }
         // This hash is weak (but efficient) and must be replace with some other
         // more stable hash algorithm. For example current hash algorithms gives
@@ -108,16 +113,34 @@ public:
             return found->second.first;
         }
 
-        m_binary_output.write(ptr, size);
-        m_hash_to_file_positions.insert({hash, {offset, static_cast<void const*>(ptr)}});
+        const auto stored = store(ptr, size, element_size);
+        m_hash_to_file_positions.insert({hash, {stored, static_cast<void const*>(ptr)}});
 
-        return offset;
+        return stored;
     }
 
 private:
+    // Small constants and the data which is not compressed at least by 1/8 are stored as is
+    static constexpr size_t min_compressed_size = 4096;
+
+    StoredData store(const char* ptr, size_t size, size_t element_size) {
+        const FilePosition write_pos = m_binary_output.tellp();
+        const auto offset = write_pos - m_blob_offset;
+        if (m_compress_weights && size >= min_compressed_size) {
+            const auto compressed = ov::util::weights_compression::compress(ptr, size, element_size);
+            if (compressed.size() <= size - size / 8) {
+                m_binary_output.write(compressed.data(), compressed.size());
+                return {offset, compressed.size(), true};
+            }
+        }
+        m_binary_output.write(ptr, size);
+        return {offset, size, false};
+    }
+
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_compress_weights;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -453,10 +476,19 @@ public:
                            &adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
-
-                m_xml_node.append_attribute("offset").set_value(static_cast<unsigned long long>(offset));
-                m_xml_node.append_attribute("size").set_value(static_cast<unsigned long long>(size));
+                // element_type is visited before the value
+                ov::element::Type element_type;
+                ov::AttributeAdapter<ov::element::Type>(element_type).set(m_xml_node.attribute("element_type").value());
+                const auto stored = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()),
+                                                                   size,
+                                                                   element_type.size());
+
+                m_xml_node.append_attribute("offset").set_value(static_cast<unsigned long long>(stored.offset));
+                m_xml_node.append_attribute("size").set_value(static_cast<unsigned long long>(stored.size));
+                if (stored.compressed) {
+                    m_xml_node.append_attribute("compression").set_value(
+                        ov::util::weights_compression::scheme_name);
+                }
             }
         } else if (const auto& a =
                        ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
@@ -1032,7 +1064,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool compress_weights = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1053,7 +1086,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, compress_weights);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1069,7 +1102,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f_or
     RUN_ON_FUNCTION_SCOPE(Serialize);
     auto f = f_orig->clone();
     if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets);
+        serializeFunc(*m_xmlFile, *m_binFile, f, m_version, m_custom_opsets, false, m_compress_weights);
     } else {
         auto xmlDir = ov::util::get_directory(m_xmlPath);
         if (xmlDir != m_xmlPath)
@@ -1083,7 +1116,7 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ngraph::Function>& f_or
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets);
+            serializeFunc(xml_file, bin_file, f, m_version, m_custom_opsets, false, m_compress_weights);
         } catch (const ngraph::CheckFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1130,6 +1163,10 @@ pass::Serialize::Serialize(const std::string& xmlPath, const std::string& binPat
     : pass::Serialize::Serialize(xmlPath, binPath, std::map<std::string, ngraph::OpSet>{}, version) {}
 OPENVINO_SUPPRESS_DEPRECATED_END
 
+void pass::Serialize::set_compress_weights(bool compress_weights) {
+    m_compress_weights = compress_weights;
+}
+
 OPENVINO_SUPPRESS_DEPRECATED_START
 pass::StreamSerialize::StreamSerialize(std::ostream& stream,
                                        std::map<std::string, ngraph::OpSet>&& custom_opsets,
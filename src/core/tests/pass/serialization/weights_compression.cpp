@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/graph_comparator.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+#include "openvino/util/weights_compression.hpp"
+#include "read_ir.hpp"
+#include "util/test_common.hpp"
+
+class SerializationWeightsCompressionTest : public ov::test::TestsCommon {
+protected:
+    std::string m_out_xml_path;
+    std::string m_out_bin_path;
+
+    void SetUp() override {
+        std::string filePrefix = CommonTestUtils::generateTestFilePrefix();
+        m_out_xml_path = filePrefix + ".xml";
+        m_out_bin_path = filePrefix + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_xml_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+
+    std::uintmax_t file_size(const std::string& path) {
+        std::ifstream f(path, std::ios::binary | std::ios::ate);
+        return f.tellg();
+    }
+
+    // Smooth weights with a limited set of values are compressible like the real trained weights
+    template <typename T>
+    std::shared_ptr<ov::Model> create_model(const ov::element::Type& type, size_t size) {
+        std::mt19937 gen(0);
+        std::uniform_int_distribution<int> distribution(-8, 8);
+        std::vector<T> values(size);
+        for (auto& value : values)
+            value = static_cast<T>(distribution(gen) / 4.f);
+        auto data = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{size});
+        auto weights = ov::opset8::Constant::create(type, ov::Shape{size}, values);
+        auto convert = std::make_shared<ov::opset8::Convert>(weights, ov::element::f32);
+        auto multiply = std::make_shared<ov::opset8::Multiply>(data, convert);
+        return std::make_shared<ov::Model>(ov::NodeVector{multiply}, ov::ParameterVector{data});
+    }
+
+    void compare_with_uncompressed(const std::shared_ptr<ov::Model>& expected) {
+        ov::pass::Serialize(m_out_xml_path, m_out_bin_path).run_on_model(expected);
+        const auto uncompressed_size = file_size(m_out_bin_path);
+
+        ov::pass::Serialize serialize(m_out_xml_path, m_out_bin_path);
+        serialize.set_compress_weights(true);
+        serialize.run_on_model(expected);
+        EXPECT_LT(file_size(m_out_bin_path), uncompressed_size);
+
+        std::ifstream xml(m_out_xml_path);
+        const std::string xml_content{std::istreambuf_iterator<char>(xml), std::istreambuf_iterator<char>()};
+        EXPECT_NE(xml_content.find(ov::util::weights_compression::scheme_name), std::string::npos);
+
+        auto result = ov::test::readModel(m_out_xml_path, m_out_bin_path);
+        const auto fc = FunctionsComparator::with_default()
+                            .enable(FunctionsComparator::ATTRIBUTES)
+                            .enable(FunctionsComparator::CONST_VALUES);
+        const auto res = fc.compare(result, expected);
+        EXPECT_TRUE(res.valid) << res.message;
+    }
+};
+
+TEST_F(SerializationWeightsCompressionTest, FP32) {
+    compare_with_uncompressed(create_model<float>(ov::element::f32, 3 * 1024 * 1024 + 5));
+}
+
+TEST_F(SerializationWeightsCompressionTest, FP16) {
+    compare_with_uncompressed(create_model<ov::float16>(ov::element::f16, 100000));
+}
+
+TEST_F(SerializationWeightsCompressionTest, I8) {
+    compare_with_uncompressed(create_model<int8_t>(ov::element::i8, 100000));
+}
+
+TEST_F(SerializationWeightsCompressionTest, SmallConstantsAreNotCompressed) {
+    auto model = create_model<float>(ov::element::f32, 16);
+    ov::pass::Serialize serialize(m_out_xml_path, m_out_bin_path);
+    serialize.set_compress_weights(true);
+    serialize.run_on_model(model);
+    EXPECT_EQ(file_size(m_out_bin_path), 16 * sizeof(float));
+}
+
+TEST(WeightsCompression, CorruptedDataThrows) {
+    std::vector<char> data(100000, 1);
+    auto compressed = ov::util::weights_compression::compress(data.data(), data.size(), 4);
+    compressed.resize(compressed.size() - 1);
+    std::vector<char> dst(data.size());
+    EXPECT_THROW(ov::util::weights_compression::decompress_chunk(compressed.data(),
+                                                                 compressed.size(),
+                                                                 0,
+                                                                 dst.data(),
+                                                                 dst.size()),
+                 std::runtime_error);
+}
+
+TEST(WeightsCompression, InconsistentHeaderThrows) {
+    std::vector<char> data(100000, 1);
+    const auto compressed = ov::util::weights_compression::compress(data.data(), data.size(), 4);
+    std::vector<char> dst(data.size());
+    auto with_header = [&](uint64_t chunk_size, uint64_t chunks_num) {
+        auto corrupted = compressed;
+        std::memcpy(corrupted.data() + sizeof(uint64_t), &chunk_size, sizeof(chunk_size));
+        std::memcpy(corrupted.data() + 3 * sizeof(uint64_t), &chunks_num, sizeof(chunks_num));
+        return corrupted;
+    };
+    // (raw_size + chunk_size - 1) / chunk_size overflows to 0 for the huge chunk size
+    for (const auto& corrupted : {with_header(std::numeric_limits<uint64_t>::max(), 0),
+                                  with_header(std::numeric_limits<uint64_t>::max(), 1),
+                                  with_header(data.size() + 4, 1),
+                                  with_header(data.size() / 2, 1),
+                                  with_header(data.size() / 2, 3)}) {
+        EXPECT_THROW(ov::util::weights_compression::get_chunks_num(corrupted.data(), corrupted.size(), dst.size()),
+                     std::runtime_error);
+    }
+    EXPECT_EQ(ov::util::weights_compression::get_chunks_num(compressed.data(), compressed.size(), dst.size()), 1);
+}
@@ -4,6 +4,7 @@
 
 #include "ir_deserializer.hpp"
 
+#include <exception>
 #include <pugixml.hpp>
 #include <regex>
 
@@ -12,6 +13,8 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/util/weights_compression.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
@@ -345,10 +348,40 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
                 IE_THROW() << "Empty weights data in bin file or bin file cannot be found!";
             if (m_weights->size() < offset + size)
                 IE_THROW() << "Incorrect weights in bin file!";
-            if (size < ((ngraph::shape_size(shape) * el_type.bitwidth() + 7) >> 3))
-                IE_THROW() << "Attribute and shape size are inconsistent for " << type << " op!";
+            const size_t byte_size = (ngraph::shape_size(shape) * el_type.bitwidth() + 7) >> 3;
 
             char* data = m_weights->get_ptr<char>() + offset;
+            std::string compression;
+            if (getStrAttribute(dn, "compression", compression)) {
+                if (compression != ov::util::weights_compression::scheme_name)
+                    IE_THROW() << "Unsupported weights compression " << compression << " for " << type << " op!";
+                // the chunks are decompressed in parallel directly into the constant buffer
+                auto buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(byte_size);
+                auto dst = buffer->get_ptr<char>();
+                try {
+                    const auto chunks_num = ov::util::weights_compression::get_chunks_num(data, size, byte_size);
+                    // exceptions must not leave the parallel region, the first failure is rethrown after it
+                    std::vector<std::exception_ptr> errors(chunks_num);
+                    ov::parallel_for(chunks_num, [&](size_t chunk) {
+                        try {
+                            ov::util::weights_compression::decompress_chunk(data, size, chunk, dst, byte_size);
+                        } catch (...) {
+                            errors[chunk] = std::current_exception();
+                        }
+                    });
+                    for (const auto& error : errors) {
+                        if (error)
+                            std::rethrow_exception(error);
+                    }
+                } catch (const std::runtime_error& error) {
+                    IE_THROW() << "Incorrect compressed weights in bin file for " << type << " op: " << error.what();
+                }
+                a->set(buffer);
+                return;
+            }
+            if (size < byte_size)
+                IE_THROW() << "Attribute and shape size are inconsistent for " << type << " op!";
+
             auto buffer =
                 std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
                     data,
@@ -8,6 +8,7 @@
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <vector>
 
 #include "core/transform.hpp"
 #include "core/value_info.hpp"
@@ -18,6 +19,7 @@
 #include "onnx_framework_node.hpp"
 #include "onnx_import/core/node.hpp"
 #include "onnx_import/core/null_node.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/frontend/onnx/extension/conversion.hpp"
 #include "openvino/frontend/onnx/node_context.hpp"
 #include "ops_bridge.hpp"
@@ -146,19 +148,44 @@ Graph::Graph(const std::string& model_dir,
     transform::expand_onnx_functions(*model_proto);
 
     std::map<std::string, Tensor> initializers;
-
-    // Process all initializers in the graph
-    for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
+    // External data files are mapped once, the constants share the mapped memory
+    auto mmap_cache = std::make_shared<detail::MappedMemoryCache>();
+
+    // Initializers are decoded in parallel since they are independent of each other. The decoded constants
+    // share their data with the Constant nodes created below in the model order, so the auto-generated names
+    // of the nodes do not depend on scheduling.
+    const auto& graph_initializers = m_model->get_graph().initializer();
+    std::vector<std::shared_ptr<default_opset::Constant>> decoded_constants(graph_initializers.size());
+    std::vector<std::exception_ptr> errors(graph_initializers.size());
+    ov::parallel_for(decoded_constants.size(), [&](size_t i) {
+        const auto& initializer_tensor = graph_initializers.Get(static_cast<int>(i));
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
             try {
-                ng_constant = tensor.get_ng_constant();
+                decoded_constants[i] = Tensor{initializer_tensor, m_model_dir, mmap_cache}.get_ng_constant();
             } catch (const error::invalid_external_data&) {
                 // invalid external data makes initializers creation impossible
-                throw;
+                errors[i] = std::current_exception();
             } catch (const ngraph::ngraph_error&) {
+                // failsafe constant is created below
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    });
+
+    // Process all initializers in the graph
+    for (size_t i = 0; i < decoded_constants.size(); ++i) {
+        const auto& initializer_tensor = graph_initializers.Get(static_cast<int>(i));
+        if (initializer_tensor.has_name()) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            Tensor tensor = Tensor{initializer_tensor, m_model_dir, mmap_cache};
+            std::shared_ptr<default_opset::Constant> ng_constant;
+            if (const auto& decoded_constant = decoded_constants[i]) {
+                ng_constant = std::make_shared<default_opset::Constant>(*decoded_constant);
+                ng_constant->set_friendly_name(decoded_constant->get_friendly_name());
+            } else {
                 ng_constant = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
             }
 
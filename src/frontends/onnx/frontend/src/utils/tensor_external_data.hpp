@@ -6,9 +6,26 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Memory mapped external data files of the model, every file is mapped once
+///         and shared by all tensors which refer to it. The initializers can be decoded
+///         concurrently, so the access to the files is guarded by the mutex.
+struct MappedMemoryCache {
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<ov::util::MappedMemory>> files;
+};
+using MappedMemoryHandles = std::shared_ptr<MappedMemoryCache>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +40,17 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       The external file is mapped to the memory once and stored in mmap_cache,
+    ///             the returned buffer refers to the mapped memory without copying.
+    ///             If mapping of the external file fails, the invalid_external_data exception is thrown.
+    ///
+    /// \return     External binary data shared with the file mapping
+    std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>> load_external_mmap_data(
+        const std::string& model_dir,
+        const MappedMemoryHandles& mmap_cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
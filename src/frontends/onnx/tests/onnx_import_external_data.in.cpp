@@ -111,6 +111,28 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_shared_with_file_mapping) {
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::shared_ptr<default_opset::Constant> data_a, data_b;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            if (constant->get_friendly_name() == "data_a")
+                data_a = constant;
+            if (constant->get_friendly_name() == "data_b")
+                data_b = constant;
+        }
+    }
+    ASSERT_TRUE(data_a && data_b);
+    // both tensors refer to the single mapping of the file instead of the copies of the data
+    EXPECT_EQ(data_b->get_data_ptr<char>() - data_a->get_data_ptr<char>(), 4096);
+    EXPECT_EQ(data_a->cast_vector<int32_t>(), (std::vector<int32_t>{3, 2, 1}));
+    EXPECT_EQ(data_b->cast_vector<int32_t>(), (std::vector<int32_t>{1, 2, 3}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -0,0 +1,131 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <onnx/onnx_pb.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/file_utils.hpp"
+#include "onnx_import/onnx.hpp"
+#include "openvino/op/constant.hpp"
+
+namespace {
+// The chain of the linear layers, the weights are stored in the initializers. The model is generated
+// since the large initializers are not practical for the prototxt models.
+std::string make_model_with_many_initializers(size_t layers_num, int64_t features) {
+    ONNX_NAMESPACE::ModelProto model;
+    model.set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
+    model.add_opset_import()->set_version(13);
+    auto graph = model.mutable_graph();
+    graph->set_name("many_initializers");
+
+    auto set_value_info = [&](ONNX_NAMESPACE::ValueInfoProto* value_info, const std::string& name) {
+        value_info->set_name(name);
+        auto tensor_type = value_info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(1);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(features);
+    };
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    auto add_initializer = [&](const std::string& name, const std::vector<int64_t>& dims) {
+        auto initializer = graph->add_initializer();
+        initializer->set_name(name);
+        initializer->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        int64_t size = 1;
+        for (const auto dim : dims) {
+            initializer->add_dims(dim);
+            size *= dim;
+        }
+        std::vector<float> values(static_cast<size_t>(size));
+        std::generate(values.begin(), values.end(), [&]() {
+            return distribution(generator);
+        });
+        initializer->set_raw_data(values.data(), values.size() * sizeof(float));
+    };
+
+    auto add_node = [&](const std::string& op_type, const std::vector<std::string>& inputs, const std::string& output) {
+        auto node = graph->add_node();
+        node->set_op_type(op_type);
+        for (const auto& input : inputs) {
+            node->add_input(input);
+        }
+        node->add_output(output);
+    };
+
+    std::string x = "x";
+    set_value_info(graph->add_input(), x);
+    for (size_t i = 0; i < layers_num; ++i) {
+        const auto index = std::to_string(i);
+        add_initializer("weights_" + index, {features, features});
+        add_initializer("bias_" + index, {features});
+        add_node("MatMul", {x, "weights_" + index}, "matmul_" + index);
+        add_node("Add", {"matmul_" + index, "bias_" + index}, "add_" + index);
+        x = "add_" + index;
+    }
+    set_value_info(graph->add_output(), x);
+
+    return model.SerializeAsString();
+}
+
+class ONNX_Import_Initializers_Tests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CommonTestUtils::createFile(model_path, make_model_with_many_initializers(layers_num, 256));
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(model_path);
+    }
+
+    const size_t layers_num = 32;
+    const std::string model_path = "onnx_import_many_initializers.onnx";
+};
+}  // namespace
+
+TEST_F(ONNX_Import_Initializers_Tests, ConstantsAreCreatedInModelOrder) {
+    // the initializers are decoded in parallel, the nodes are created in the model order
+    const auto function = ngraph::onnx_import::import_onnx_model(model_path);
+
+    std::vector<std::shared_ptr<ov::Node>> constants;
+    for (const auto& op : function->get_ops()) {
+        if (ov::is_type<ov::op::v0::Constant>(op)) {
+            constants.push_back(op);
+        }
+    }
+    std::sort(constants.begin(),
+              constants.end(),
+              [](const std::shared_ptr<ov::Node>& lhs, const std::shared_ptr<ov::Node>& rhs) {
+                  return lhs->get_instance_id() < rhs->get_instance_id();
+              });
+
+    ASSERT_EQ(constants.size(), 2 * layers_num);
+    for (size_t i = 0; i < layers_num; ++i) {
+        EXPECT_EQ(constants[2 * i]->get_friendly_name(), "weights_" + std::to_string(i));
+        EXPECT_EQ(constants[2 * i + 1]->get_friendly_name(), "bias_" + std::to_string(i));
+    }
+}
+
+// run it with --gtest_also_run_disabled_tests to measure the import time
+TEST_F(ONNX_Import_Initializers_Tests, DISABLED_ImportBenchmark) {
+    const int iterations = 20;
+    // warm up the file cache and the threads
+    ngraph::onnx_import::import_onnx_model(model_path);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        ngraph::onnx_import::import_onnx_model(model_path);
+    }
+    const auto time =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+    RecordProperty("import_time_ms", std::to_string(time));
+    std::cout << model_path << " import time: " << time << " ms" << std::endl;
+}
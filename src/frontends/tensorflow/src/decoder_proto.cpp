@@ -4,10 +4,17 @@
 
 #include "decoder_proto.hpp"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include <cstring>
+
 #include "attr_value.pb.h"
+#include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/frontend/tensorflow/special_types.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "types.pb.h"
 
 namespace ov {
@@ -30,19 +37,52 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
     return type_map;
 }
 
+// Exposes the tensor content of the model file memory or of the parsed graph proto as memory of ov::Tensor,
+// the owner of the content is kept alive while the tensor or a Constant built on it exists.
+class SharedTensorContent : public ov::AllocatorImpl {
+public:
+    SharedTensorContent(const char* data, size_t size, const std::shared_ptr<void>& owner)
+        : m_data(const_cast<char*>(data)),
+          m_size(size),
+          m_owner(owner) {}
+
+    void* allocate(const size_t bytes, const size_t) override {
+        FRONT_END_GENERAL_CHECK(bytes <= m_size, "Size of tensor is not equal to tensor_content size.");
+        return m_data;
+    }
+
+    void deallocate(void*, const size_t, size_t) override {}
+
+    bool is_equal(const AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    char* m_data;
+    size_t m_size;
+    std::shared_ptr<void> m_owner;
+};
+
+bool can_share_tensor_content(const char* tensor_content,
+                              size_t tensor_content_size,
+                              const ov::element::Type& type,
+                              const ov::Shape& shape) {
+    return type != ov::element::boolean && tensor_content_size == ov::shape_size(shape) * type.size() &&
+           reinterpret_cast<uintptr_t>(tensor_content) % type.size() == 0;
+}
+
+// the tensor content of the model file memory may be unaligned, so it is copied bytewise
 template <typename T>
-void extract_tensor_content(const std::string& tensor_content, ov::Tensor* values) {
-    const auto tensor_content_size = tensor_content.size();
+void extract_tensor_content(const char* tensor_content, size_t tensor_content_size, ov::Tensor* values) {
     FRONT_END_GENERAL_CHECK(tensor_content_size % sizeof(T) == 0,
                             "Size of tensor_content (",
                             tensor_content_size,
                             ") is not a multiple of ",
                             sizeof(T));
 
-    const T* tensor_values = reinterpret_cast<const T*>(tensor_content.data());
     FRONT_END_GENERAL_CHECK(values->get_size() == tensor_content_size / sizeof(T),
                             "Size of tensor is not equal to tensor_content size.");
-    std::copy(tensor_values, tensor_values + tensor_content_size / sizeof(T), values->data<T>());
+    std::memcpy(values->data<T>(), tensor_content, tensor_content_size);
 }
 
 #if defined(_MSC_VER)
@@ -94,25 +134,103 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
 #if defined(_MSC_VER)
 #    pragma warning(pop)
 #endif
+
+using google::protobuf::internal::WireFormatLite;
+
+// Calls on_field(field_number) for every length delimited field of the message which ends at the current limit
+// of the stream, the stream is limited by the field while on_field reads it. Other fields are skipped.
+// The stream must be limited by the size of the data, so the truncated fields are detected.
+template <typename OnField>
+bool scan_message(google::protobuf::io::CodedInputStream& stream, OnField on_field) {
+    while (const auto tag = stream.ReadTag()) {
+        if (WireFormatLite::GetTagWireType(tag) != WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+            if (!WireFormatLite::SkipField(&stream, tag))
+                return false;
+            continue;
+        }
+        int size = 0;
+        if (!stream.ReadVarintSizeAsInt(&size) || size > stream.BytesUntilLimit())
+            return false;
+        const auto limit = stream.PushLimit(size);
+        if (!on_field(WireFormatLite::GetTagFieldNumber(tag)) || !stream.Skip(stream.BytesUntilLimit()))
+            return false;
+        stream.PopLimit(limit);
+    }
+    return stream.ConsumedEntireMessage();
+}
 }  // namespace
 
+std::vector<MappedTensorContent> find_tensor_contents(const char* data, size_t size) {
+    // GraphDef.node -> NodeDef.attr -> the map entry with "value" key -> AttrValue.tensor -> TensorProto.tensor_content
+    const int graph_node = 1, node_attr = 5, entry_key = 1, entry_value = 2, attr_tensor = 8, tensor_content = 4;
+    google::protobuf::io::CodedInputStream stream(reinterpret_cast<const uint8_t*>(data), static_cast<int>(size));
+    stream.PushLimit(static_cast<int>(size));
+    std::vector<MappedTensorContent> contents;
+    const bool scanned = scan_message(stream, [&](int graph_field) {
+        if (graph_field != graph_node)
+            return true;
+        // the last "value" entry wins as it does in the parsed map
+        MappedTensorContent node_content;
+        const bool node_scanned = scan_message(stream, [&](int node_field) {
+            if (node_field != node_attr)
+                return true;
+            std::string key;
+            MappedTensorContent value_content;
+            const bool entry_scanned = scan_message(stream, [&](int entry_field) {
+                if (entry_field == entry_key)
+                    return stream.ReadString(&key, stream.BytesUntilLimit());
+                if (entry_field != entry_value)
+                    return true;
+                return scan_message(stream, [&](int attr_field) {
+                    if (attr_field != attr_tensor)
+                        return true;
+                    return scan_message(stream, [&](int tensor_field) {
+                        if (tensor_field == tensor_content) {
+                            value_content.data = data + stream.CurrentPosition();
+                            value_content.size = static_cast<size_t>(stream.BytesUntilLimit());
+                        }
+                        return true;
+                    });
+                });
+            });
+            if (key == "value")
+                node_content = value_content;
+            return entry_scanned;
+        });
+        contents.push_back(node_content);
+        return node_scanned;
+    });
+    return scanned ? contents : std::vector<MappedTensorContent>{};
+}
+
+bool release_tensor_content(::tensorflow::NodeDef* node_def, const MappedTensorContent& tensor_content) {
+    auto attr_map = node_def->mutable_attr();
+    const auto it = attr_map->find("value");
+    if (it == attr_map->end() || !it->second.has_tensor() ||
+        it->second.tensor().tensor_content().size() != tensor_content.size) {
+        return false;
+    }
+    std::string().swap(*it->second.mutable_tensor()->mutable_tensor_content());
+    return true;
+}
+
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto attr = decode_attribute_helper(name);
+    if (!attr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         if (tf_shape.unknown_rank()) {
             return ov::PartialShape::dynamic();
         }
@@ -125,8 +243,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -134,7 +252,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -186,7 +304,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -198,36 +316,47 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
+        // the tensor content of the value attribute is released from the graph proto and read from the model file
+        const bool is_mapped = m_tensor_content.data && name == "value";
+        const auto tensor_content = is_mapped ? m_tensor_content.data : tensor_proto.tensor_content().data();
+        const auto tensor_content_size = is_mapped ? m_tensor_content.size : tensor_proto.tensor_content().size();
+        const auto owner = is_mapped ? std::shared_ptr<void>(m_model_memory) : std::shared_ptr<void>(m_graph_def);
+        if (owner && tensor_content_size > 0 && tensor_proto.has_tensor_shape() &&
+            can_share_tensor_content(tensor_content, tensor_content_size, ov_type, pshape.get_shape())) {
+            return ov::Tensor(
+                ov_type,
+                pshape.get_shape(),
+                ov::Allocator(std::make_shared<SharedTensorContent>(tensor_content, tensor_content_size, owner)));
+        }
         ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
-        if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
+        if (tensor_content_size > 0 && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
-                extract_tensor_content<uint8_t>(tensor_content, &res);
+                extract_tensor_content<uint8_t>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::i8:
-                extract_tensor_content<int8_t>(tensor_content, &res);
+                extract_tensor_content<int8_t>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::i16:
-                extract_tensor_content<int16_t>(tensor_content, &res);
+                extract_tensor_content<int16_t>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::i32:
-                extract_tensor_content<int32_t>(tensor_content, &res);
+                extract_tensor_content<int32_t>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::i64:
-                extract_tensor_content<int64_t>(tensor_content, &res);
+                extract_tensor_content<int64_t>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::f16:
-                extract_tensor_content<float16>(tensor_content, &res);
+                extract_tensor_content<float16>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::f32:
-                extract_tensor_content<float>(tensor_content, &res);
+                extract_tensor_content<float>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::f64:
-                extract_tensor_content<double>(tensor_content, &res);
+                extract_tensor_content<double>(tensor_content, tensor_content_size, &res);
                 break;
             case ov::element::bf16:
-                extract_tensor_content<bfloat16>(tensor_content, &res);
+                extract_tensor_content<bfloat16>(tensor_content, tensor_content_size, &res);
                 break;
             default:
                 FRONT_END_THROW("Encountered unknown element type " + ov_type.get_type_name());
@@ -271,11 +400,11 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
                                 name,
                                 "' attribute is not supported.");
     case ::tensorflow::AttrValue::ValueCase::kFunc:
-        // attrs[0].func() returns NameAttrList object from which
+        // attr->func() returns NameAttrList object from which
         // we retrieve the function name
         // Further, InputModel object is created for FunctionDef with this name
         // and is converted to ov::Model object.
-        return attrs[0].func().name();
+        return attr->func().name();
     default:
         FRONT_END_GENERAL_CHECK(false, "Conversion from Tensorflow to OpenVINO data type failed.");
     }
@@ -315,14 +444,11 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    // the attribute is not copied, the tensor content shared with the graph proto must outlive the call
+    const auto& attr_map = m_node_def->attr();
+    const auto it = attr_map.find(name);
+    return it != attr_map.end() ? &it->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,24 +4,62 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "openvino/frontend/tensorflow/decoder.hpp"
 
 namespace tensorflow {
+class GraphDef;
 class NodeDef;
 class AttrValue;
 }  // namespace tensorflow
 
 namespace ov {
+namespace util {
+class MappedMemory;
+}  // namespace util
+
 namespace frontend {
 namespace tensorflow {
 
+/// \brief Location of the tensor content of the node "value" attribute in the memory of the model file
+struct MappedTensorContent {
+    const char* data = nullptr;
+    size_t size = 0;
+};
+
+/// \brief Finds the tensor content of the "value" attribute of every node of the serialized GraphDef
+/// \return The contents indexed by the node index, the nodes without the content get the empty entry.
+///         The result is empty if the model can't be scanned.
+std::vector<MappedTensorContent> find_tensor_contents(const char* data, size_t size);
+
+/// \brief Releases the parsed tensor content of the node "value" attribute found in the model file memory
+/// \return False if the parsed content doesn't match the found one, the parsed content is kept in this case
+bool release_tensor_content(::tensorflow::NodeDef* node_def, const MappedTensorContent& tensor_content);
+
 class DecoderProto : public ov::frontend::tensorflow::DecoderBase {
 public:
     explicit DecoderProto(const ::tensorflow::NodeDef* node_def) : m_node_def(node_def) {}
 
+    /// \brief Creates the decoder of the node owned by graph_def, tensor attributes share the tensor content
+    ///        with graph_def instead of copying it
+    DecoderProto(const ::tensorflow::NodeDef* node_def, const std::shared_ptr<::tensorflow::GraphDef>& graph_def)
+        : m_node_def(node_def),
+          m_graph_def(graph_def) {}
+
+    /// \brief Creates the decoder of the node owned by graph_def, the tensor content of the "value" attribute is
+    ///        released from graph_def and shared with the memory of the model file
+    DecoderProto(const ::tensorflow::NodeDef* node_def,
+                 const std::shared_ptr<::tensorflow::GraphDef>& graph_def,
+                 const std::shared_ptr<ov::util::MappedMemory>& model_memory,
+                 const MappedTensorContent& tensor_content)
+        : m_node_def(node_def),
+          m_graph_def(graph_def),
+          m_model_memory(model_memory),
+          m_tensor_content(tensor_content) {}
+
     ov::Any get_attribute(const std::string& name) const override;
 
     size_t get_input_size() const override;
@@ -35,8 +73,11 @@ public:
     const std::string& get_op_name() const override;
 
 private:
-    std::vector<::tensorflow::AttrValue> decode_attribute_helper(const std::string& name) const;
+    const ::tensorflow::AttrValue* decode_attribute_helper(const std::string& name) const;
     const ::tensorflow::NodeDef* m_node_def;
+    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
+    std::shared_ptr<ov::util::MappedMemory> m_model_memory;
+    MappedTensorContent m_tensor_content;
 };
 }  // namespace tensorflow
 }  // namespace frontend
@@ -4,7 +4,9 @@
 
 #pragma once
 
-#include <fstream>
+#include <google/protobuf/arena.h>
+
+#include <climits>
 
 #include "decoder_argdef.hpp"
 #include "decoder_proto.hpp"
@@ -12,6 +14,7 @@
 #include "openvino/frontend/exception.hpp"
 #include "openvino/frontend/tensorflow/decoder.hpp"
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 namespace frontend {
@@ -19,7 +22,7 @@ namespace tensorflow {
 
 class GraphIteratorProto : public GraphIterator {
     std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
-    std::shared_ptr<::tensorflow::FunctionDef> m_func_def;
+    std::shared_ptr<const ::tensorflow::FunctionDef> m_func_def;
 
     size_t node_index = 0;
     std::vector<std::shared_ptr<DecoderBase>> m_decoders;
@@ -29,7 +32,7 @@ class GraphIteratorProto : public GraphIterator {
 
 public:
     GraphIteratorProto(const std::shared_ptr<::tensorflow::GraphDef>& graph_def,
-                       const std::shared_ptr<::tensorflow::FunctionDef>& func_def,
+                       const std::shared_ptr<const ::tensorflow::FunctionDef>& func_def,
                        const std::unordered_map<std::string, int>& library_map)
         : m_graph_def(graph_def),
           m_func_def(func_def),
@@ -50,7 +53,7 @@ public:
 
         // fill all node defs from library functions
         for (int node_ind = 0; node_ind < nodes_size; ++node_ind) {
-            m_decoders.push_back(std::make_shared<DecoderProto>(&(m_func_def->node_def(node_ind))));
+            m_decoders.push_back(std::make_shared<DecoderProto>(&(m_func_def->node_def(node_ind)), m_graph_def));
         }
 
         // fill all outputs from library functions
@@ -66,24 +69,44 @@ public:
 
     template <typename T>
     GraphIteratorProto(const std::basic_string<T>& path)
-        : m_graph_def(std::make_shared<::tensorflow::GraphDef>()),
+        : m_graph_def(nullptr),
           m_func_def(nullptr) {
-        std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
+        // The model file is parsed directly from the memory mapping, the messages are allocated on the arena
+        // and the graph keeps the arena alive. Protobuf copies the tensor content while parsing, so the content
+        // of the constants is found in the mapping and the parsed copy is released, the constants share the mapping.
+        std::shared_ptr<ov::util::MappedMemory> mapped_model;
+        try {
+            mapped_model = ov::util::load_mmap_object(path);
+        } catch (const std::runtime_error&) {
+        }
+        FRONT_END_GENERAL_CHECK(mapped_model, "Model file does not exist");
+        FRONT_END_GENERAL_CHECK(mapped_model->size() <= static_cast<size_t>(INT_MAX),
+                                "Model cannot be parsed: protobuf message size exceeds 2 GB");
 
-        FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
-        FRONT_END_GENERAL_CHECK(m_graph_def->ParseFromIstream(&pb_stream), "Model cannot be parsed");
+        auto arena = std::make_shared<google::protobuf::Arena>();
+        auto graph_def = google::protobuf::Arena::CreateMessage<::tensorflow::GraphDef>(arena.get());
+        const auto model_size = static_cast<int>(mapped_model->size());
+        FRONT_END_GENERAL_CHECK(graph_def->ParseFromArray(model_size > 0 ? mapped_model->data() : nullptr, model_size),
+                                "Model cannot be parsed");
+        m_graph_def = std::shared_ptr<::tensorflow::GraphDef>(arena, graph_def);
 
         auto nodes_size = m_graph_def->node_size();
+        auto tensor_contents = find_tensor_contents(mapped_model->data(), mapped_model->size());
+        if (tensor_contents.size() != static_cast<size_t>(nodes_size))
+            tensor_contents.assign(static_cast<size_t>(nodes_size), MappedTensorContent{});
         m_decoders.resize(static_cast<size_t>(nodes_size));
         for (int node_ind = 0; node_ind < nodes_size; ++node_ind) {
-            m_decoders[node_ind] = std::make_shared<DecoderProto>(&m_graph_def->node(node_ind));
+            auto node_def = m_graph_def->mutable_node(node_ind);
+            auto& tensor_content = tensor_contents[node_ind];
+            if (tensor_content.data && !release_tensor_content(node_def, tensor_content))
+                tensor_content = MappedTensorContent{};
+            m_decoders[node_ind] = std::make_shared<DecoderProto>(node_def, m_graph_def, mapped_model, tensor_content);
         }
 
         // initialize a library map
         auto num_funcs = m_graph_def->library().function_size();
         for (int func_ind = 0; func_ind < num_funcs; ++func_ind) {
-            auto func = m_graph_def->library().function(func_ind);
-            auto func_name = func.signature().name();
+            const auto& func_name = m_graph_def->library().function(func_ind).signature().name();
             m_library_map.insert(std::pair<std::string, int>(func_name, func_ind));
         }
     }
@@ -119,8 +142,10 @@ public:
                 0 <= func_ind && func_ind < func_size,
                 "[TensorFlow Error] Internal Error: incorrect library map to cache function indices by names.");
 
-            auto func = m_graph_def->library().function(func_ind);
-            auto func_ptr = std::make_shared<::tensorflow::FunctionDef>(func);
+            // the function body is owned by the graph, so it is shared instead of copying
+            auto func_ptr =
+                std::shared_ptr<const ::tensorflow::FunctionDef>(m_graph_def,
+                                                                 &m_graph_def->library().function(func_ind));
             return std::make_shared<GraphIteratorProto>(m_graph_def, func_ptr, m_library_map);
         }
 
@@ -4,7 +4,9 @@
 
 #include "translate_session.hpp"
 
+#include "common_op_table.hpp"
 #include "input_model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "tf_framework_node.hpp"
 #include "utils.hpp"
@@ -36,6 +38,51 @@ std::vector<T> reorder_ops_by_names(const std::vector<std::string>& names, const
     }
     return resulted_ops;
 };
+
+// only the built-in translator of Const is known to read nothing but the attributes of the decoder,
+// a translator registered by an extension gets the original decoder
+bool is_builtin_const_translator(const TranslatorDictionaryType& translator_map) {
+    using BuiltinTranslator = ov::OutputVector (*)(const ov::frontend::NodeContext&);
+    const auto translator = translator_map.find("Const");
+    if (translator == translator_map.end())
+        return false;
+    const auto target = translator->second.target<BuiltinTranslator>();
+    return target && *target == ov::frontend::tensorflow::op::translate_const_op;
+}
+
+// returns the value of Const decoded in advance, the other requests are forwarded to the decoder of the operation
+class DecoderWithDecodedValue : public DecoderBase {
+public:
+    DecoderWithDecodedValue(std::shared_ptr<DecoderBase> decoder, ov::Any value)
+        : m_decoder(std::move(decoder)),
+          m_value(std::move(value)) {}
+
+    ov::Any get_attribute(const std::string& name) const override {
+        return name == "value" ? m_value : m_decoder->get_attribute(name);
+    }
+
+    size_t get_input_size() const override {
+        return m_decoder->get_input_size();
+    }
+
+    void get_input_node(size_t input_port_idx,
+                        std::string& producer_name,
+                        size_t& producer_output_port_index) const override {
+        m_decoder->get_input_node(input_port_idx, producer_name, producer_output_port_index);
+    }
+
+    const std::string& get_op_type() const override {
+        return m_decoder->get_op_type();
+    }
+
+    const std::string& get_op_name() const override {
+        return m_decoder->get_op_name();
+    }
+
+private:
+    std::shared_ptr<DecoderBase> m_decoder;
+    ov::Any m_value;
+};
 }  // namespace
 
 TranslateSession::TranslateSession(const ov::frontend::InputModel::Ptr& input_model,
@@ -126,8 +173,31 @@ void TranslateSession::translate_graph(const ov::frontend::InputModel::Ptr& inpu
         ng_op_map[input_name] = {param};
     }
 
+    // Const operations do not depend on other operations and the decoding of their values is the most
+    // expensive part of the conversion, so the values are decoded in advance in parallel. The nodes are
+    // created by the loop below in the model order, so the auto-generated names do not depend on scheduling.
+    std::vector<ov::Any> const_values(operation_places.size());
+    if (is_builtin_const_translator(*m_translator_map)) {
+        ov::parallel_for(operation_places.size(), [&](size_t op_ind) {
+            const auto& operation_decoder = operation_places[op_ind]->get_decoder();
+            if (operation_decoder->get_op_type() != "Const" ||
+                ng_op_map.count(operation_places[op_ind]->get_names()[0])) {
+                return;
+            }
+            try {
+                const auto dtype = operation_decoder->get_attribute("dtype");
+                if (dtype.is<ov::element::Type>() && dtype.as<ov::element::Type>() != ov::element::undefined) {
+                    const_values[op_ind] = operation_decoder->get_attribute("value");
+                }
+            } catch (...) {
+                // the value is decoded once again by the translator, which reports the error in the model order
+            }
+        });
+    }
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t op_ind = 0; op_ind < operation_places.size(); ++op_ind) {
+        const auto& operation_place = operation_places[op_ind];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
@@ -202,7 +272,12 @@ void TranslateSession::translate_graph(const ov::frontend::InputModel::Ptr& inpu
         try {
             if (m_translator_map->count(operation_type)) {
                 auto translator = m_translator_map->at(operation_decoder->get_op_type());
-                NodeContext node_context(operation_decoder, ov_inputs, this);
+                auto translator_decoder = operation_decoder;
+                if (!const_values[op_ind].empty()) {
+                    translator_decoder =
+                        std::make_shared<DecoderWithDecodedValue>(operation_decoder, std::move(const_values[op_ind]));
+                }
+                NodeContext node_context(translator_decoder, ov_inputs, this);
                 ov_outputs = translator(node_context);
                 is_converted = true;
             } else if (auto body_ov_model = get_body_ov_model(operation_type)) {
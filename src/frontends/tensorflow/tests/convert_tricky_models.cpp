@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
 #include <openvino/frontend/exception.hpp>
 #include <openvino/frontend/manager.hpp>
 #include <openvino/opsets/opset10.hpp>
@@ -38,6 +43,24 @@ shared_ptr<Model> convert_model(const string& model_path) {
 
     return model;
 }
+
+// friendly names of the constants in the order of their creation
+vector<string> get_constants_by_creation(const shared_ptr<Model>& model) {
+    vector<shared_ptr<Node>> constants;
+    for (const auto& node : model->get_ops()) {
+        if (is_type<Constant>(node)) {
+            constants.push_back(node);
+        }
+    }
+    sort(constants.begin(), constants.end(), [](const shared_ptr<Node>& lhs, const shared_ptr<Node>& rhs) {
+        return lhs->get_instance_id() < rhs->get_instance_id();
+    });
+    vector<string> names;
+    for (const auto& constant : constants) {
+        names.push_back(constant->get_friendly_name());
+    }
+    return names;
+}
 }  // namespace
 
 TEST(FrontEndConvertTrickyModels, undefined_input_shape) {
@@ -94,6 +117,107 @@ TEST(FrontEndConvertTrickyModels, model_with_output_shapes) {
     }
 }
 
+TEST(FrontEndConvertTrickyModels, many_constants_creation_order) {
+    // the values of the constants are decoded in parallel, the nodes are created in the model order
+    shared_ptr<Model> model;
+    try {
+        model = convert_model("many_constants/many_constants.pb");
+    } catch (std::exception& ex) {
+        ASSERT_TRUE(false) << ex.what();
+    }
+
+    const auto constants = get_constants_by_creation(model);
+    ASSERT_EQ(constants.size(), 64u);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_EQ(constants, get_constants_by_creation(convert_model("many_constants/many_constants.pb")));
+    }
+}
+
+// run it with --gtest_also_run_disabled_tests to measure the conversion time
+TEST(FrontEndConvertTrickyModels, DISABLED_many_constants_conversion_benchmark) {
+    const int iterations = 20;
+    // warm up the file cache and the threads
+    convert_model("many_constants/many_constants.pb");
+
+    const auto start = chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        convert_model("many_constants/many_constants.pb");
+    }
+    const auto time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / iterations;
+    RecordProperty("conversion_time_ms", to_string(time));
+    cout << "many_constants.pb conversion time: " << time << " ms" << endl;
+}
+
+TEST(FrontEndConvertTrickyModels, shared_constants) {
+    // the constants share the tensor content of the memory mapped model file, the content which is not aligned
+    // to the element type is copied
+    FrontEndManager fem;
+    auto front_end = fem.load_by_framework(TF_FE);
+    ASSERT_NE(front_end, nullptr);
+    const auto model_filename = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                                   "shared_constants/shared_constants.pb");
+    ifstream model_file(model_filename, ios::binary);
+    const string model_bytes((istreambuf_iterator<char>(model_file)), istreambuf_iterator<char>());
+    ASSERT_FALSE(model_bytes.empty());
+
+    auto input_model = front_end->load(model_filename);
+    ASSERT_NE(input_model, nullptr);
+    shared_ptr<Model> model, model_again;
+    ASSERT_NO_THROW(model = front_end->convert(input_model));
+    ASSERT_NO_THROW(model_again = front_end->convert(input_model));
+    map<string, shared_ptr<Constant>> constants, constants_again;
+    for (const auto& node : model->get_ops()) {
+        if (auto constant = as_type_ptr<Constant>(node))
+            constants[constant->get_friendly_name()] = constant;
+    }
+    for (const auto& node : model_again->get_ops()) {
+        if (auto constant = as_type_ptr<Constant>(node))
+            constants_again[constant->get_friendly_name()] = constant;
+    }
+
+    // the mapping starts at the page boundary, so the shared content keeps the offset in the page
+    const uintptr_t page_size = 4096;
+    const vector<pair<string, element::Type>> types{{"float32", f32},
+                                                    {"float64", f64},
+                                                    {"int32", i32},
+                                                    {"int64", i64},
+                                                    {"float16", f16},
+                                                    {"int8", i8}};
+    size_t shared_num = 0, copied_num = 0;
+    for (const auto& type : types) {
+        for (size_t shift = 0; shift < 4; ++shift) {
+            const auto name = type.first + "_" + to_string(shift);
+            ASSERT_EQ(constants.count(name), 1u) << name;
+            const auto& constant = constants.at(name);
+            ASSERT_EQ(constant->get_element_type(), type.second) << name;
+            ASSERT_EQ(constant->get_shape(), Shape{16 + shift}) << name;
+
+            const auto fraction = type.second.is_real() ? 0.25 : 0.0;
+            vector<double> expected(16 + shift);
+            for (size_t j = 0; j < expected.size(); ++j) {
+                expected[j] = 1.0 + 20.0 * shift + j + fraction;
+            }
+            ASSERT_EQ(constant->cast_vector<double>(), expected) << name;
+            ASSERT_EQ(constants_again.at(name)->cast_vector<double>(), expected) << name;
+
+            const auto data = static_cast<const char*>(constant->get_data_ptr());
+            const auto offset = model_bytes.find(string(data, constant->get_byte_size()));
+            ASSERT_NE(offset, string::npos) << name;
+            if (offset % type.second.size() == 0) {
+                ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % page_size, offset % page_size) << name;
+                ASSERT_EQ(constants_again.at(name)->get_data_ptr(), data) << name;
+                ++shared_num;
+            } else {
+                ASSERT_NE(constants_again.at(name)->get_data_ptr(), data) << name;
+                ++copied_num;
+            }
+        }
+    }
+    // the model has both the aligned and the unaligned contents
+    ASSERT_GT(shared_num, 0u);
+    ASSERT_GT(copied_num, 0u);
+}
+
 TEST_F(TransformationTestsF, AssertAndStringTensors) {
     {
         model = convert_model("string_tensors_model/string_tensors_model.pb");
@@ -0,0 +1,24 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model: a chain of fully connected layers, the weights are large constants
+with tf.compat.v1.Session() as sess:
+    layers_num = 32
+    features = 256
+    x = tf.compat.v1.placeholder(tf.float32, [1, features], 'x')
+    for i in range(layers_num):
+        weights = tf.constant(np.random.randn(features, features), dtype=tf.float32, name="weights_{}".format(i))
+        bias = tf.constant(np.random.randn(features), dtype=tf.float32, name="bias_{}".format(i))
+        x = tf.nn.relu(tf.add(tf.matmul(x, weights), bias), name="relu_{}".format(i))
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "many_constants"), 'many_constants.pb', False)
@@ -0,0 +1,25 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import sys
+import tensorflow as tf
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model: constants of the different types and sizes, the names and the sizes of the different
+# lengths place the tensor contents at the different offsets of the model file, so some of them are not aligned
+# to the element type. The value of the constant "<type>_<shift>" is [1 + 20 * shift + j + 0.25] for j < 16 + shift,
+# the integer types have no fractional part.
+with tf.compat.v1.Session() as sess:
+    for dtype in [np.float32, np.float64, np.int32, np.int64, np.float16, np.int8]:
+        for shift in range(4):
+            values = np.arange(16 + shift, dtype=np.float64) + 1 + 20 * shift
+            if np.issubdtype(dtype, np.floating):
+                values += 0.25
+            tf.constant(values.astype(dtype), name="{}_{}".format(np.dtype(dtype).name, shift))
+
+    tf_net = sess.graph_def
+
+tf.io.write_graph(tf_net, os.path.join(sys.argv[1], "shared_constants"), 'shared_constants.pb', False)
@@ -21,8 +21,9 @@ OutputVector translate_const_op(const NodeContext& node) {
     if (ov_type == element::undefined) {
         const_node = std::make_shared<UnsupportedConstant>();
     } else {
+        // the constant shares the tensor memory which can be provided by the model proto without copying
         auto tensor = node.get_attribute<Tensor>("value");
-        const_node = std::make_shared<Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+        const_node = std::make_shared<Constant>(tensor);
     }
     set_node_name(node.get_name(), const_node);
     return {const_node};
@@ -14,18 +14,15 @@ GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file;
-    model_file.open(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    model_file.seekg(0, std::ios::end);
-    auto length = model_file.tellg();
-    model_file.seekg(0, std::ios::beg);
-    char* data = new char[length];
-    model_file.read(data, length);
-    model_file.close();
+    // The model file is mapped into memory, so the constant buffers are shared with the model instead of copying
+    try {
+        m_model_memory = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error&) {
+    }
+    FRONT_END_GENERAL_CHECK(m_model_memory, "Model file does not exist: ", path);
 
-    m_model = std::shared_ptr<tflite::Model>(tflite::GetMutableModel(data), [](tflite::Model* p) {});
+    // the model keeps the mapped memory alive
+    m_model = std::shared_ptr<const tflite::Model>(m_model_memory, tflite::GetModel(m_model_memory->data()));
     const auto subgraphs = m_model->subgraphs();
     FRONT_END_GENERAL_CHECK(subgraphs->size() == 1,
                             "Number of sub-graphs in the model is ",
@@ -4,11 +4,10 @@
 
 #pragma once
 
-#include <fstream>
-
 #include "decoder_flatbuffer.h"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -25,7 +24,8 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<const tflite::Operator*> m_nodes;
-    std::shared_ptr<tflite::Model> m_model;
+    std::shared_ptr<ov::util::MappedMemory> m_model_memory;
+    std::shared_ptr<const tflite::Model> m_model;
 
 public:
     explicit GraphIteratorFlatBuffer(const std::string& path);
@@ -58,6 +58,11 @@ public:
 
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
+
+    /// Return memory of the mapped model file, the tensor data of the decoders points to it
+    const std::shared_ptr<ov::util::MappedMemory>& get_model_memory() const {
+        return m_model_memory;
+    }
 };
 
 }  // namespace tensorflow_lite
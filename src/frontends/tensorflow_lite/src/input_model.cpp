@@ -4,9 +4,11 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -76,6 +78,29 @@ private:
     std::shared_ptr<TelemetryExtension> m_telemetry;
 };
 
+namespace {
+// Constant shares the buffer of the mapped model file if the data is aligned to the element type,
+// quantized weights are shared as is since the quantization is applied on top of the constant
+std::shared_ptr<ov::op::v0::Constant> make_constant(const ov::element::Type& type,
+                                                    const ov::Shape& shape,
+                                                    const void* data,
+                                                    const std::shared_ptr<ov::util::MappedMemory>& model_memory) {
+    const auto byte_size = (ov::shape_size(shape) * type.bitwidth() + 7) / 8;
+    const auto begin = static_cast<const char*>(data);
+    const bool in_model = model_memory && begin >= model_memory->data() &&
+                          begin + byte_size <= model_memory->data() + model_memory->size();
+    const bool is_aligned = reinterpret_cast<uintptr_t>(data) % std::max<size_t>(type.size(), 1) == 0;
+    if (!in_model || !is_aligned)
+        return ov::op::v0::Constant::create(type, shape, data);
+
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        const_cast<char*>(begin),
+        byte_size,
+        model_memory);
+    return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+}
+}  // namespace
+
 void InputModel::InputModelTFLiteImpl::loadModel() {
     std::map<std::string, uint64_t> op_statistics;  // for telemetry
 
@@ -97,9 +122,10 @@ void InputModel::InputModelTFLiteImpl::loadModel() {
                     // will reorder by index later
                     m_inputs.push_back(place);
                 } else if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = make_constant(place->get_element_type(),
+                                                  place->get_partial_shape().to_shape(),
+                                                  data,
+                                                  m_graph_iterator->get_model_memory());
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else {
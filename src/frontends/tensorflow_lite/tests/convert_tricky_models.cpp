@@ -0,0 +1,96 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fstream>
+#include <iterator>
+#include <openvino/frontend/manager.hpp>
+#include <openvino/opsets/opset10.hpp>
+
+#include "gtest/gtest.h"
+#include "tf_utils.hpp"
+#include "utils.hpp"
+
+using namespace std;
+using namespace ov;
+using namespace ov::element;
+using namespace ov::opset10;
+using namespace ov::frontend;
+
+namespace {
+shared_ptr<Constant> get_constant(const shared_ptr<Model>& model, const element::Type& type) {
+    for (const auto& node : model->get_ops()) {
+        auto constant = as_type_ptr<Constant>(node);
+        if (constant && constant->get_element_type() == type) {
+            return constant;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+// The constants share the buffers of the memory mapped model file if the content is aligned to the element type,
+// the misaligned content is copied. The models are converted twice from the same input model, so the shared
+// constants of both conversions point to the same memory.
+class FrontEndConvertTrickyModels : public ::testing::Test {
+protected:
+    void convert(const string& model_name) {
+        FrontEndManager fem;
+        auto front_end = fem.load_by_framework(TF_LITE_FE);
+        ASSERT_NE(front_end, nullptr);
+        const auto model_path =
+            FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) + model_name);
+        ifstream model_file(model_path, ios::binary);
+        model_bytes.assign(istreambuf_iterator<char>(model_file), istreambuf_iterator<char>());
+        ASSERT_FALSE(model_bytes.empty());
+
+        auto input_model = front_end->load(model_path);
+        ASSERT_NE(input_model, nullptr);
+        ASSERT_NO_THROW(model = front_end->convert(input_model));
+        ASSERT_NO_THROW(model_again = front_end->convert(input_model));
+    }
+
+    void check_constant(const element::Type& type, const vector<double>& expected, bool& is_shared) {
+        const auto constant = get_constant(model, type);
+        const auto constant_again = get_constant(model_again, type);
+        ASSERT_NE(constant, nullptr);
+        ASSERT_NE(constant_again, nullptr);
+        ASSERT_EQ(constant->cast_vector<double>(), expected);
+        ASSERT_EQ(constant_again->cast_vector<double>(), expected);
+
+        // the generator moves the content of the int64 constant to the end of the model file
+        const auto data = static_cast<const char*>(constant->get_data_ptr());
+        const auto offset = model_bytes.rfind(string(data, constant->get_byte_size()));
+        ASSERT_NE(offset, string::npos);
+        is_shared = offset % type.size() == 0;
+        if (is_shared) {
+            // the mapping starts at the page boundary, so the shared content keeps the offset in the page
+            const uintptr_t page_size = 4096;
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % page_size, offset % page_size);
+            ASSERT_EQ(constant_again->get_data_ptr(), data);
+        } else {
+            ASSERT_NE(constant_again->get_data_ptr(), data);
+        }
+    }
+
+    const vector<double> weights{0.5, 1.5, 2.5, 3.5, 4.5, 5.5};
+    const vector<double> offsets{1000000007.0, 2000000014.0, 3000000021.0, 4000000028.0, 5000000035.0};
+    string model_bytes;
+    shared_ptr<Model> model, model_again;
+};
+
+TEST_F(FrontEndConvertTrickyModels, shared_constants) {
+    ASSERT_NO_FATAL_FAILURE(convert("shared_constants/shared_constants.tflite"));
+    bool is_shared = false;
+    ASSERT_NO_FATAL_FAILURE(check_constant(f32, weights, is_shared));
+    ASSERT_NO_FATAL_FAILURE(check_constant(i64, offsets, is_shared));
+    ASSERT_TRUE(is_shared);
+}
+
+TEST_F(FrontEndConvertTrickyModels, misaligned_shared_constants) {
+    ASSERT_NO_FATAL_FAILURE(convert("shared_constants/shared_constants_misaligned.tflite"));
+    bool is_shared = true;
+    ASSERT_NO_FATAL_FAILURE(check_constant(f32, weights, is_shared));
+    ASSERT_NO_FATAL_FAILURE(check_constant(i64, offsets, is_shared));
+    ASSERT_FALSE(is_shared);
+}
@@ -0,0 +1,63 @@
+# Copyright (C) 2018-2023 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+import numpy as np
+import os
+import struct
+import sys
+
+# do not print messages from TensorFlow
+os.environ['TF_CPP_MIN_LOG_LEVEL'] = '3'
+import tensorflow as tf
+from tensorflow.lite.python import schema_py_generated as schema_fb
+
+
+def move_int64_content(tflite_model, misalignment):
+    # Moves the content of the int64 constant to the end of the model, the content is placed at the given offset
+    # from the 8 bytes boundary. The vector of the content is addressed relatively to the field of the buffer.
+    model_bytes = bytearray(tflite_model)
+    model = schema_fb.Model.GetRootAsModel(model_bytes, 0)
+    subgraph = model.Subgraphs(0)
+    for tensor_idx in range(subgraph.TensorsLength()):
+        tensor = subgraph.Tensors(tensor_idx)
+        buffer = model.Buffers(tensor.Buffer())
+        if tensor.Type() != schema_fb.TensorType.INT64 or buffer.DataLength() == 0:
+            continue
+        content = buffer.DataAsNumpy().tobytes()
+        # the vector starts with the 4 bytes length
+        model_bytes += bytes((misalignment - len(model_bytes) - 4) % 8)
+        vector_pos = len(model_bytes)
+        model_bytes += struct.pack('<I', len(content)) + content
+        field_pos = buffer._tab.Pos + buffer._tab.Offset(4)
+        struct.pack_into('<I', model_bytes, field_pos, vector_pos - field_pos)
+        break
+    return model_bytes
+
+
+tf.compat.v1.reset_default_graph()
+
+# Create the graph and model: the constants are added to the inputs, the value of "weights" is [j + 0.5]
+# and the value of "offsets" is [(j + 1) * 1000000007]
+with tf.compat.v1.Session() as sess:
+    x = tf.compat.v1.placeholder(tf.float32, [2, 3], 'x')
+    y = tf.compat.v1.placeholder(tf.int64, [5], 'y')
+    weights = tf.constant(np.arange(6, dtype=np.float32).reshape(2, 3) + 0.5, name="weights")
+    offsets = tf.constant((np.arange(5, dtype=np.int64) + 1) * 1000000007, name="offsets")
+    tf.add(x, weights, name="add_weights")
+    tf.add(y, offsets, name="add_offsets")
+
+    tf.compat.v1.global_variables_initializer()
+    tf_net = sess.graph_def
+
+path_to_model_dir = os.path.join(sys.argv[1], "shared_constants")
+tf_file_name = 'shared_constants.pb'
+tf.io.write_graph(tf_net, path_to_model_dir, tf_file_name, False)
+
+converter = tf.compat.v1.lite.TFLiteConverter.from_frozen_graph(os.path.join(path_to_model_dir, tf_file_name),
+                                                                ["x", "y"], ["add_weights", "add_offsets"])
+tflite_model = converter.convert()
+
+# the content of the int64 constant is aligned in the first model and misaligned in the second one
+for tflite_file_name, misalignment in [('shared_constants.tflite', 0), ('shared_constants_misaligned.tflite', 4)]:
+    with tf.io.gfile.GFile(os.path.join(path_to_model_dir, tflite_file_name), 'wb') as f:
+        f.write(move_int64_content(tflite_model, misalignment))
@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
+#include "cpp_interfaces/plugin_itt.hpp"
 #include "threading/ie_immediate_executor.hpp"
 #include "threading/ie_istreams_executor.hpp"
 #include "threading/ie_itask_executor.hpp"
@@ -178,6 +179,7 @@ public:
      * @return A status code
      */
     StatusCode Wait(int64_t millis_timeout) override {
+        OV_ITT_SCOPED_TASK(itt::domains::Plugin, "AsyncInferRequest::Wait");
         if (millis_timeout < InferRequest::WaitMode::RESULT_READY) {
             IE_THROW(ParameterMismatch) << " Timeout can't be less " << InferRequest::WaitMode::RESULT_READY
                                         << " for InferRequest::Wait\n";
@@ -216,6 +218,7 @@ public:
     }
 
     void StartAsync() override {
+        OV_ITT_SCOPED_TASK(itt::domains::Plugin, "AsyncInferRequest::StartAsync");
         InferImpl([&] {
             StartAsync_ThreadUnsafe();
         });
@@ -404,7 +407,10 @@ private:
                 try {
                     auto& stageTask = std::get<Stage_e::task>(thisStage);
                     IE_ASSERT(nullptr != stageTask);
-                    stageTask();
+                    {
+                        OV_ITT_SCOPED_TASK(itt::domains::Plugin, "AsyncInferRequest::Stage");
+                        stageTask();
+                    }
                     if (itEndStage != itNextStage) {
                         auto& nextStage = *itNextStage;
                         auto& nextStageExecutor = std::get<Stage_e::executor>(nextStage);
@@ -425,6 +431,7 @@ private:
                             std::swap(callback, _callback);
                         }
                         if (callback) {
+                            OV_ITT_SCOPED_TASK(itt::domains::Plugin, "AsyncInferRequest::Callback");
                             try {
                                 callback(currentException);
                             } catch (...) {
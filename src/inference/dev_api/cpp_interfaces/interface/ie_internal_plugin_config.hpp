@@ -121,6 +121,13 @@ DECLARE_CONFIG_VALUE(ENABLE);
 DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
 DECLARE_CONFIG_VALUE(DISABLE);
 
+/**
+ * @brief Enables the cost based reassignment of the memory layouts after the greedy selection
+ * of the primitive descriptors in the CPU plugin (values: YES or NO, default NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_ASSIGNMENT);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -12,9 +12,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <limits>
 #include <map>
+#include <numeric>
 #include <vector>
 
+#include "ie_parallel.hpp"
+
 /**
  * @brief Helps to solve issue of optimal memory allocation only for particular
  *        execution order.
@@ -40,6 +44,10 @@
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The boxes are placed one by one at the lowest offset (first fit) or into the smallest gap (best fit)
+ *  between the already placed boxes alive at the same time. The placed boxes are indexed by their live time,
+ *  so only the boxes intersecting on the ExecOrder-axis are visited.
  */
 
 class MemorySolver {
@@ -115,61 +123,27 @@ public:
         _time_duration = normalizeBoxes(_boxes);
     }
 
-    inline bool popupTogetherWith(MemorySolver::Box& box_new, const MemorySolver::Box& box_old) {
-        if (box_new.id + box_new.size > box_old.id && box_old.id + box_old.size > box_new.id) {
-            // Move the new one up. There is an intersection
-            box_new.id = box_old.id + box_old.size;
-            return true;
-        } else {
-            return false;
-        }
-    }
-
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param try_all_heuristics Places the boxes with every known heuristic in parallel and keeps the smallest
+     *        result. Otherwise the biggest boxes are placed first at the lowest possible offsets.
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve() {
-        maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-        std::vector<std::vector<const Box*>> time_slots(_time_duration);
-        for (auto& slot : time_slots)
-            slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-        // Sort be box size. First is biggest
-        // Comment this line to check other order of box putting
-        std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r) {
-            return l.size > r.size;
+    int64_t solve(bool try_all_heuristics = false) {
+        const size_t num_heuristics = try_all_heuristics ? Heuristic::Count : 1;
+        std::vector<std::vector<int64_t>> offsets(num_heuristics);
+        std::vector<int64_t> required(num_heuristics);
+        InferenceEngine::parallel_for(num_heuristics, [&](size_t i) {
+            required[i] = place(static_cast<Heuristic>(i), offsets[i]);
         });
 
-        int64_t _min_required = 0;
-
-        for (Box& box : _boxes) {
-            // start from bottom and will lift it up if intersect with other present
-            int64_t id = box.id;
-            box.id = 0;  // id will be used as a temp offset storage
-            bool popped_up;
-            do {
-                popped_up = false;
-                for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                    for (auto* box_in_slot : time_slots[i_slot]) {
-                        // intersect with already stored boxes for all covered time slots
-                        // and move up the new one if needed
-                        // Execution of 'popupTogetherWith' is important even if 'popped_up' is already 'true'
-                        popped_up = popupTogetherWith(box, *box_in_slot) || popped_up;
-                    }
-                }
-            } while (popped_up);
-
-            // add current box to covered time slot
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-                time_slots[i_slot].push_back(&box);
+        // the first heuristic wins the ties, so the result doesn't depend on the threads
+        const auto best = std::min_element(required.begin(), required.end()) - required.begin();
+        _offsets.clear();
+        for (size_t i = 0; i < _boxes.size(); i++)
+            _offsets[_boxes[i].id] = offsets[best][i];
 
-            // store the max top bound for each box
-            _min_required = std::max(_min_required, box.id + box.size);
-            _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
-        }
-
-        return _min_required;
+        return required[best];
     }
 
     /** Provides calculated offset for specified box id */
@@ -194,6 +168,134 @@ public:
     }
 
 private:
+    enum Heuristic {
+        SizeFirstFit,   // the biggest boxes first, at the lowest offset
+        SizeBestFit,    // the biggest boxes first, into the smallest gap
+        AreaBestFit,    // the boxes with the biggest size * live time first, into the smallest gap
+        StartBestFit,   // the boxes in the execution order, the biggest first for the same start, into the smallest gap
+        Count
+    };
+
+    /**
+     * Segment tree over the execution order. Every box is stored in the nodes which cover its live time
+     * and are not covered by it entirely, so the boxes intersecting the given time range are found
+     * in the nodes intersecting it only.
+     */
+    class TimeIndex {
+    public:
+        explicit TimeIndex(int duration) {
+            while (_leaves < duration)
+                _leaves *= 2;
+            _nodes.resize(2 * _leaves);
+        }
+
+        void insert(int start, int finish, size_t box) {
+            insert(1, 0, _leaves - 1, start, finish, box);
+        }
+
+        // calls func for every box intersecting [start, finish], the boxes may be repeated
+        template <typename F>
+        void query(int start, int finish, const F& func) const {
+            query(1, 0, _leaves - 1, start, finish, func);
+        }
+
+    private:
+        void insert(size_t node, int left, int right, int start, int finish, size_t box) {
+            if (finish < left || right < start)
+                return;
+            if (start <= left && right <= finish) {
+                _nodes[node].push_back(box);
+                return;
+            }
+            const int middle = (left + right) / 2;
+            insert(2 * node, left, middle, start, finish, box);
+            insert(2 * node + 1, middle + 1, right, start, finish, box);
+        }
+
+        template <typename F>
+        void query(size_t node, int left, int right, int start, int finish, const F& func) const {
+            if (finish < left || right < start)
+                return;
+            for (const auto box : _nodes[node])
+                func(box);
+            if (left == right)
+                return;
+            const int middle = (left + right) / 2;
+            query(2 * node, left, middle, start, finish, func);
+            query(2 * node + 1, middle + 1, right, start, finish, func);
+        }
+
+        int _leaves = 1;
+        std::vector<std::vector<size_t>> _nodes;
+    };
+
+    std::vector<size_t> order(Heuristic heuristic) const {
+        std::vector<size_t> indices(_boxes.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        const auto area = [](const Box& box) {
+            return box.size * (box.finish - box.start + 1);
+        };
+        // the boxes are sorted by start already, the stable sort keeps it for the equal keys
+        std::stable_sort(indices.begin(), indices.end(), [&](size_t l, size_t r) {
+            const Box& lhs = _boxes[l];
+            const Box& rhs = _boxes[r];
+            switch (heuristic) {
+            case AreaBestFit:
+                return area(lhs) > area(rhs);
+            case StartBestFit:
+                return lhs.start < rhs.start || (lhs.start == rhs.start && lhs.size > rhs.size);
+            default:
+                return lhs.size > rhs.size;
+            }
+        });
+        return indices;
+    }
+
+    /** Places the boxes in the order of the heuristic, returns the required size and fills the offsets */
+    int64_t place(Heuristic heuristic, std::vector<int64_t>& offsets) const {
+        const bool best_fit = heuristic != SizeFirstFit;
+        offsets.assign(_boxes.size(), 0);
+        TimeIndex placed(_time_duration);
+        // the stamp of the last box which visited the placed one, to skip the repeated boxes of the time index
+        std::vector<size_t> visited(_boxes.size(), std::numeric_limits<size_t>::max());
+        std::vector<std::pair<int64_t, int64_t>> busy;  // [offset, offset + size) of the intersecting boxes
+
+        int64_t min_required = 0;
+        for (const auto i : order(heuristic)) {
+            const Box& box = _boxes[i];
+            busy.clear();
+            placed.query(box.start, box.finish, [&](size_t j) {
+                if (visited[j] != i) {
+                    visited[j] = i;
+                    busy.emplace_back(offsets[j], offsets[j] + _boxes[j].size);
+                }
+            });
+            std::sort(busy.begin(), busy.end());
+
+            // sweep the gaps between the busy ranges from the bottom, the space above all of them is unlimited
+            int64_t offset = -1;
+            int64_t best_gap = std::numeric_limits<int64_t>::max();
+            int64_t bottom = 0;
+            for (const auto& range : busy) {
+                const int64_t gap = range.first - bottom;
+                if (gap >= box.size && gap < best_gap) {
+                    offset = bottom;
+                    best_gap = gap;
+                    if (!best_fit)
+                        break;
+                }
+                bottom = std::max(bottom, range.second);
+            }
+            if (offset == -1)
+                offset = bottom;
+
+            offsets[i] = offset;
+            placed.insert(box.start, box.finish, i);
+            min_required = std::max(min_required, offset + box.size);
+        }
+        return min_required;
+    }
+
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
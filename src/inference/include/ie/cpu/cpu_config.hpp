@@ -42,5 +42,26 @@ DECLARE_CPU_CONFIG_KEY(DENORMALS_OPTIMIZATION);
 
 DECLARE_CPU_CONFIG_KEY(SPARSE_WEIGHTS_DECOMPRESSION_RATE);
 
+/**
+ * @brief The name for enabling the auto-tuning of the number of streams and threads for the performance hints
+ *
+ * If enabled, the CPU plugin compiles the model with several streams/threads configurations around
+ * the heuristic choice of the performance hint, runs each of them for a short time on the zero inputs
+ * and keeps the fastest one. It makes the model loading longer, but the choice is stored in the model cache
+ * and reused on the next loading. The option has no effect if the number of streams is set explicitly.
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default)
+ */
+DECLARE_CPU_CONFIG_KEY(STREAMS_AUTO_TUNING);
+
+/**
+ * @brief The name for defining the upper bound of the memory in bytes the compiled model is allowed to use
+ *
+ * The CPU plugin estimates the footprint of the model during the loading and reduces the number of streams
+ * to fit the budget. If a single stream does not fit, the loading fails.
+ * It is passed to Core::SetConfig(), this option should be used with the number of bytes, 0 (default) means no limit
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_BUDGET);
+
 }  // namespace CPUConfigParams
 }  // namespace InferenceEngine
@@ -18,5 +18,53 @@ namespace intel_auto {
  */
 static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
 
+/**
+ * @brief Enum to define the policy used by MULTI to distribute infer requests among the devices
+ */
+enum class SchedulePolicy {
+    DEVICE_PRIORITY = 0,  //!<  Use the first device (in priority order) that has an idle infer request
+    LOAD_AWARE = 1,       //!<  Use the device with the lowest expected completion time based on observed latency
+    DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy) {
+    switch (policy) {
+    case SchedulePolicy::DEVICE_PRIORITY:
+        return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::LOAD_AWARE:
+        return os << "LOAD_AWARE";
+    default:
+        throw ov::Exception{"Unsupported schedule policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEVICE_PRIORITY") {
+        policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "LOAD_AWARE") {
+        policy = SchedulePolicy::LOAD_AWARE;
+    } else {
+        throw ov::Exception{"Unsupported schedule policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief multi device setting that selects how infer requests are distributed among the devices
+ */
+static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
+/**
+ * @brief Read-only property returning the execution statistics that MULTI observed per device.
+ * For every device the map holds the exponentially weighted latency ("LATENCY_MS"),
+ * throughput ("THROUGHPUT_FPS"), number of completed ("INFER_COUNT") and in-flight ("IN_FLIGHT") requests
+ */
+static constexpr Property<std::map<std::string, ov::AnyMap>, PropertyMutability::RO> device_statistics{
+    "DEVICE_STATISTICS"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -49,5 +49,75 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property defines whether the number of streams and threads for the performance hint is tuned
+ * by the measurements on the model during compile_model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Several streams configurations around the heuristic choice are compiled and run for a short time,
+ * the fastest one is kept. The loading time grows, so it is recommended to use it together with the model cache,
+ * which stores the choice.
+ *
+ * @code
+ * ie.set_property(ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT));
+ * ie.set_property(ov::intel_cpu::streams_auto_tuning(true));
+ * @endcode
+ */
+static constexpr Property<bool> streams_auto_tuning{"CPU_STREAMS_AUTO_TUNING"};
+
+/**
+ * @brief This property defines the upper bound of the memory in bytes the compiled model is allowed to use.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The footprint of the model is estimated during compile_model by an extra compilation of a single stream.
+ * If the estimated footprint of all the streams exceeds the budget, the number of streams is reduced and
+ * the weights are shared by all the NUMA nodes. If a single stream does not fit, compile_model throws.
+ * Zero (default) means no limit.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::memory_budget(512 * 1024 * 1024));
+ * @endcode
+ */
+static constexpr Property<uint64_t> memory_budget{"CPU_MEMORY_BUDGET"};
+
+/**
+ * @brief Read-only property to get the memory footprint of the compiled model in bytes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The map contains the following entries:
+ *  - "shared_weights": the weights shared by the streams on the same NUMA node, counted once per NUMA node.
+ *    It includes the weights repacked by the primitives, which are shared with the other compiled models as well
+ *  - "stream_weights": the weights and the folded constants owned by the streams, summed over the streams
+ *  - "activations": the intermediate tensors, summed over the streams
+ *  - "scratchpads": the scratchpads of the primitives, summed over the streams
+ *  - "total": the sum of all the above
+ *  - "streams": the number of streams
+ *  - "runtime_cache_entries": the number of the primitives in the runtime caches of the streams
+ *
+ * @code
+ * auto footprint = compiled_model.get_property(ov::intel_cpu::memory_footprint);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_footprint{
+    "CPU_MEMORY_FOOTPRINT"};
+
+/**
+ * @brief Read-only property to get the result of the cost based layout assignment of the compiled model.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The assignment runs only if it is enabled by the internal CPU_LAYOUT_ASSIGNMENT config key, otherwise
+ * all the entries are zero. The map contains the following entries:
+ *  - "reorders_before": the reorders between the non constant tensors after the greedy layout selection
+ *  - "reorders_after": the reorders left after the assignment
+ *  - "reorders_eliminated": the difference of the above
+ *  - "changed_nodes": the number of nodes with the reassigned layouts
+ *
+ * @code
+ * auto report = compiled_model.get_property(ov::intel_cpu::layout_assignment_report);
+ * @endcode
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> layout_assignment_report{
+    "CPU_LAYOUT_ASSIGNMENT_REPORT"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -17,6 +17,7 @@
 #include <utility>
 #include <vector>
 
+#include "ie_itt.hpp"
 #include "ie_parallel_custom_arena.hpp"
 #include "ie_system_conf.h"
 #include "threading/ie_executor_manager.hpp"
@@ -299,6 +300,7 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Enqueue(Task task) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CPUStreamsExecutor::Enqueue");
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -307,6 +309,7 @@ struct CPUStreamsExecutor::Impl {
     }
 
     void Execute(const Task& task, Stream& stream) {
+        OV_ITT_SCOPED_TASK(ov::itt::domains::IE, "CPUStreamsExecutor::Execute");
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         auto& arena = stream._taskArena;
         if (nullptr != arena) {
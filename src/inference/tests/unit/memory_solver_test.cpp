@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <ie_common.h>
 
+#include <random>
 #include <vector>
 
 using Box = MemorySolver::Box;
@@ -143,7 +144,7 @@ TEST(MemSolverTest, LinearWithEmptyExecIndexes) {
 //  |  |_4__|_____ |    |
 //  |__|_2________||_1__|___
 //      2  3  4  5  6  7  8
-TEST(MemSolverTest, DISABLED_Unefficiency) {
+TEST(MemSolverTest, Unefficiency) {
     std::vector<Box> boxes{
         {6, 7, 3},
         {2, 5, 2},
@@ -152,7 +153,8 @@ TEST(MemSolverTest, DISABLED_Unefficiency) {
     };
 
     MemorySolver ms(boxes);
-    EXPECT_EQ(ms.solve(), 5);  // currently we have answer 6
+    EXPECT_EQ(ms.solve(), 6);  // the biggest first at the lowest offset
+    EXPECT_EQ(ms.solve(true), 5);
     EXPECT_EQ(ms.maxDepth(), 5);
     EXPECT_EQ(ms.maxTopDepth(), 2);
 }
@@ -292,9 +294,8 @@ TEST(MemSolverTest, NoOverlapping) {
     };
 
     MemorySolver ms(boxes);
-    ms.solve();
-    // TODO: Current algorithm doesn't solve that case. Uncomment check to see inefficiency
-    // EXPECT_EQ(ms.solve(), 5);
+    // The biggest first heuristic doesn't solve that case, the best fit ones do
+    EXPECT_EQ(ms.solve(true), 5);
 
     auto no_overlap = [&](Box box1, Box box2) -> bool {
         int64_t off1 = ms.getOffset(static_cast<int>(box1.id));
@@ -337,3 +338,36 @@ TEST(MemSolverTest, BestSolution1) {
         for (int j = i + 1; j < n; j++)
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
+
+TEST(MemSolverTest, NoOverlappingOnRandomBoxes) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> live_time(0, 20);
+    std::uniform_int_distribution<int64_t> size(1, 1000);
+
+    const int n = 2000;
+    std::vector<Box> boxes;
+    for (int i = 0; i < n; i++) {
+        // every 50th box lives till the end like the inputs and the outputs of the graph
+        const int finish = i % 50 ? i + live_time(gen) : -1;
+        boxes.push_back({i, finish, size(gen), i});
+    }
+
+    for (const bool try_all_heuristics : {false, true}) {
+        MemorySolver ms(boxes);
+        const auto required = ms.solve(try_all_heuristics);
+        EXPECT_GE(required, ms.maxDepth());
+
+        for (int i = 0; i < n; i++) {
+            const auto& box1 = boxes[i];
+            const int64_t off1 = ms.getOffset(i);
+            ASSERT_LE(off1 + box1.size, required);
+            for (int j = i + 1; j < n; j++) {
+                const auto& box2 = boxes[j];
+                const int64_t off2 = ms.getOffset(j);
+                const bool time_overlap = box1.finish == -1 || box2.start <= box1.finish;
+                ASSERT_TRUE(!time_overlap || off1 + box1.size <= off2 || off1 >= off2 + box2.size)
+                    << "Box overlapping is detected";
+            }
+        }
+    }
+}
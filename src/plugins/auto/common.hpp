@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <limits>
 #include <map>
+#include <mutex>
 #include <string>
 #include "ie_icore.hpp"
 #include "ie_metric_helpers.hpp"
@@ -51,6 +53,70 @@ struct DeviceInformation {
     unsigned int devicePriority;
 };
 
+// per-device execution statistics, used by the LOAD_AWARE schedule policy
+// and reported via the ov::intel_auto::device_statistics property
+struct DeviceStatistics {
+    // weight of the newest sample in the exponentially weighted moving averages
+    static constexpr double ewmaAlpha = 0.2;
+    // the latency of a device which didn't start a request for this time is stale,
+    // so the idle device is probed with the next request to refresh it
+    static constexpr double probeIntervalMs = 1000.0;
+
+    void RequestStarted(const Time& startTime = std::chrono::steady_clock::now()) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _inFlight++;
+        _lastStartTime = startTime;
+    }
+    void RequestCompleted(const Time& startTime) {
+        const auto endTime = std::chrono::steady_clock::now();
+        const double latency = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_inFlight > 0)
+            _inFlight--;
+        if (_inferCount == 0) {
+            _latencyMs = latency;
+        } else {
+            _latencyMs += ewmaAlpha * (latency - _latencyMs);
+            const double interval = std::chrono::duration<double, std::milli>(endTime - _lastEndTime).count();
+            _intervalMs = _inferCount == 1 ? interval : _intervalMs + ewmaAlpha * (interval - _intervalMs);
+        }
+        _lastEndTime = endTime;
+        _inferCount++;
+    }
+    // expected time until a newly scheduled request completes on the device:
+    // the request waits in the queue when all the device's requests are in flight
+    double ExpectedCompletionTime(const Time& now = std::chrono::steady_clock::now()) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_inferCount == 0 || _numWorkers == 0) {
+            // no samples yet: let the device get requests first, but never wait for it
+            return _inFlight < _numWorkers ? 0.0 : std::numeric_limits<double>::max();
+        }
+        // otherwise a device which is slower than the others would never get a request to update its latency
+        if (_inFlight < _numWorkers &&
+            std::chrono::duration<double, std::milli>(now - _lastStartTime).count() >= probeIntervalMs) {
+            return 0.0;
+        }
+        const double load = static_cast<double>(_inFlight + 1) / _numWorkers;
+        return _latencyMs * std::max(1.0, load);
+    }
+    ov::AnyMap ToAnyMap() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return {{"LATENCY_MS", _latencyMs},
+                {"THROUGHPUT_FPS", _intervalMs > 0.0 ? 1000.0 / _intervalMs : 0.0},
+                {"INFER_COUNT", static_cast<uint64_t>(_inferCount)},
+                {"IN_FLIGHT", static_cast<uint64_t>(_inFlight)}};
+    }
+
+    double     _latencyMs = 0.0;
+    double     _intervalMs = 0.0;
+    Time       _lastEndTime;
+    Time       _lastStartTime;
+    size_t     _inferCount = 0;
+    size_t     _inFlight = 0;
+    size_t     _numWorkers = 0;
+    std::mutex _mutex;
+};
+
 struct WorkerInferRequest {
     SoInfer            _inferRequest;
     IE::Task           _task;
@@ -58,6 +124,9 @@ struct WorkerInferRequest {
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
     int                _index = 0;
+    // set only for the workers whose device statistics are collected
+    DeviceStatistics*  _statistics = nullptr;
+    Time               _lastStartTime;
 };
 
 using NotBusyPriorityWorkerRequests = IE::ThreadSafeBoundedPriorityQueue<std::pair<int, WorkerInferRequest*>>;
@@ -123,6 +192,8 @@ public:
     bool                                           _needPerfCounters;
     bool                                           _batchingDisabled = {false};
     bool                                           _bindBuffer = false;
+    ov::intel_auto::SchedulePolicy                 _schedulePolicy = ov::intel_auto::SchedulePolicy::DEFAULT;
+    DeviceMap<DeviceStatistics>                    _deviceStatistics;
     virtual ~MultiScheduleContext() = default;
 };
 
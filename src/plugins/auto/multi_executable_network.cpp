@@ -99,6 +99,7 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             ov::PropertyName{ov::supported_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::optimal_number_of_infer_requests.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::intel_auto::device_statistics.name(), ov::PropertyMutability::RO},
 
             // Configs
             // device priority can be changed on-the-fly in MULTI
@@ -120,6 +121,12 @@ IE::Parameter MultiExecutableNetwork::GetMetric(const std::string& name) const {
             }
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type {res};
+    } else if (name == ov::intel_auto::device_statistics) {
+        std::map<std::string, ov::AnyMap> statistics;
+        for (auto&& deviceStatistics : _multiSContext->_deviceStatistics) {
+            statistics[deviceStatistics.first] = deviceStatistics.second.ToAnyMap();
+        }
+        return decltype(ov::intel_auto::device_statistics)::value_type {statistics};
     } else if (name == ov::model_name) {
         auto it = _multiSContext->_networksPerDevice.begin();
         IE_ASSERT(it != _multiSContext->_networksPerDevice.end());
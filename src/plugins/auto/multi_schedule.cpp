@@ -143,16 +143,20 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    auto& statistics = _multiSContext->_deviceStatistics[device];
+    statistics._numWorkers = numRequests;
     int num = 0;
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
         auto* workerRequestPtr = &workerRequest;
         workerRequestPtr->_index = num++;
+        workerRequestPtr->_statistics = &statistics;
         IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
         workerRequest._inferRequest->SetCallback(
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_statistics->RequestCompleted(workerRequestPtr->_lastStartTime);
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -178,6 +182,22 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
         return _multiSContext->_devicePriorities;
     }();
+    const bool loadAware = preferred_device.empty() &&
+        _multiSContext->_schedulePolicy == ov::intel_auto::SchedulePolicy::LOAD_AWARE;
+    if (loadAware && !devices.empty()) {
+        SortDevicesByExpectedCompletion(devices);
+        // the expected completion time of a busy device includes the queueing delay, so when the best device
+        // has no idle request it is still worth waiting for rather than falling back to a slower device
+        const auto& best = devices.front().deviceName;
+        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[best], preferred_device)) {
+            return true;
+        }
+        if (_multiSContext->_deviceStatistics.at(best).ExpectedCompletionTime() <
+            std::numeric_limits<double>::max()) {
+            _inferPipelineTasksDeviceSpecific[best]->push(std::move(inferPipelineTask));
+            return false;
+        }
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
             continue;
@@ -213,6 +233,24 @@ bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     return false;
 }
 
+void MultiSchedule::SortDevicesByExpectedCompletion(std::vector<DeviceInformation>& devices) {
+    std::vector<std::pair<double, DeviceInformation>> timedDevices;
+    timedDevices.reserve(devices.size());
+    for (auto&& device : devices) {
+        timedDevices.emplace_back(_multiSContext->_deviceStatistics.at(device.deviceName).ExpectedCompletionTime(),
+                                  std::move(device));
+    }
+    // stable, so the devices with equal expectation keep the priority order
+    std::stable_sort(timedDevices.begin(), timedDevices.end(),
+        [](const std::pair<double, DeviceInformation>& a, const std::pair<double, DeviceInformation>& b) {
+            return a.first < b.first;
+        });
+    devices.clear();
+    for (auto&& timedDevice : timedDevices) {
+        devices.push_back(std::move(timedDevice.second));
+    }
+}
+
 void MultiSchedule::run(IE::Task inferPipelineTask) {
     ScheduleToWorkerInferRequest(std::move(inferPipelineTask), _thisPreferredDeviceName);
 }
@@ -19,6 +19,10 @@ struct ThisRequestExecutor : public IE::ITaskExecutor {
     explicit ThisRequestExecutor(WorkerInferRequest** ptr): _workptrptr{ptr} {}
     void run(IE::Task task) override {
         (*_workptrptr)->_task = std::move(task);
+        if ((*_workptrptr)->_statistics) {
+            (*_workptrptr)->_lastStartTime = std::chrono::steady_clock::now();
+            (*_workptrptr)->_statistics->RequestStarted((*_workptrptr)->_lastStartTime);
+        }
         (*_workptrptr)->_inferRequest->StartAsync();
     };
     WorkerInferRequest** _workptrptr = nullptr;
@@ -47,6 +51,8 @@ protected:
     virtual void GenerateWorkers(const std::string& device, const IE::SoExecutableNetworkInternal& executableNetwork);
     static bool RunPipelineTask(IE::Task& inferPipelineTask, NotBusyWorkerRequests& idleWorkerRequests, const DeviceName& preferred_device);
     virtual bool ScheduleToWorkerInferRequest(IE::Task, DeviceName preferred_device = "");
+    // orders the devices by the expected completion time of a new request (LOAD_AWARE policy)
+    void SortDevicesByExpectedCompletion(std::vector<DeviceInformation>& devices);
     std::string GetLogTag() const noexcept;
 
 protected:
@@ -242,6 +242,8 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
                 return ov::util::from_string(val, ov::auto_batch_timeout);
             } else if (name == ov::intel_auto::device_bind_buffer) {
                 return val == PluginConfigParams::YES ? true : false;
+            } else if (name == ov::intel_auto::schedule_policy) {
+                return ov::util::from_string(val, ov::intel_auto::schedule_policy);
             } else if (name == ov::log::level) {
                 return ov::util::from_string(val, ov::log::level);
             } else if (name == ov::device::priorities) {
@@ -604,6 +606,12 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
     multiSContext->_needPerfCounters = enablePerfCounters;
     multiSContext->_core = GetCore();
     multiSContext->_LogTag = _LogTag;
+    auto policyIter = fullConfig.find(ov::intel_auto::schedule_policy.name());
+    if (policyIter != fullConfig.end()) {
+        multiSContext->_schedulePolicy = ov::util::from_string(policyIter->second, ov::intel_auto::schedule_policy);
+        multiNetworkConfig[policyIter->first] = policyIter->second;
+        LOG_INFO_TAG("schedule policy:%s", policyIter->second.c_str());
+    }
     IExecutableNetworkInternal::Ptr impl;
     auto tmpiter = fullConfig.find(ov::intel_auto::device_bind_buffer.name());
     if (tmpiter != fullConfig.end() && tmpiter->second == PluginConfigParams::YES) {
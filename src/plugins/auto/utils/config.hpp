@@ -24,6 +24,7 @@ struct PluginConfig {
                 _devicePriority(""),
                 _modelPriority(1),
                 _deviceBindBuffer(false),
+                _schedulePolicy("DEVICE_PRIORITY"),
                 _logLevel("LOG_NONE") {
         adjustKeyMapValues();
     }
@@ -41,6 +42,7 @@ struct PluginConfig {
             return res;
         }();
         auto multi_supported_configKeys = supported_configKeys;
+        multi_supported_configKeys.push_back(ov::intel_auto::schedule_policy.name());
         return pluginName == "AUTO" ? supported_configKeys : multi_supported_configKeys;
     }
 
@@ -73,6 +75,7 @@ struct PluginConfig {
             return supportedProperties;
         }();
         auto multi_supported_properties = supported_properties;
+        multi_supported_properties.emplace_back(ov::intel_auto::schedule_policy.name(), ov::PropertyMutability::RW);
         return pluginName == "AUTO" ? supported_properties : multi_supported_properties;
     }
 
@@ -158,6 +161,12 @@ struct PluginConfig {
                 else
                     IE_THROW() << "Unsupported config value: " << kvp.second
                             << " for key: " << kvp.first;
+            } else if (kvp.first == ov::intel_auto::schedule_policy.name()) {
+                if (kvp.second == "DEVICE_PRIORITY" || kvp.second == "LOAD_AWARE")
+                    _schedulePolicy = kvp.second;
+                else
+                    IE_THROW() << "Unsupported config value: " << kvp.second
+                            << " for key: " << kvp.first;
             } else if (kvp.first == ov::device::priorities.name()) {
                 if (!kvp.second.empty())
                     ParsePrioritiesDevices(kvp.second);
@@ -264,6 +273,8 @@ struct PluginConfig {
 
         _keyConfigMap[ov::auto_batch_timeout.name()] = _batchTimeout;
 
+        _keyConfigMap[ov::intel_auto::schedule_policy.name()] = _schedulePolicy;
+
         _keyConfigMap[ov::log::level.name()] = _logLevel;
 
         _keyConfigMap[ov::cache_dir.name()] = _cacheDir;
@@ -281,6 +292,7 @@ struct PluginConfig {
     std::string _devicePriority;
     int _modelPriority;
     bool _deviceBindBuffer;
+    std::string _schedulePolicy;
     std::string _logLevel;
     PerfHintsConfig  _perfHintsConfig;
     // Add this flag to check if user app sets hint with none value that is equal to the default value of hint.
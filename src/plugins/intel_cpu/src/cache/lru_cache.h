@@ -85,6 +85,14 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of the cached records
+     * @return the number of the cached records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
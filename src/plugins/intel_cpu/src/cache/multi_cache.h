@@ -49,6 +49,16 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the total number of the records of all the entries
+    */
+    size_t size() const {
+        size_t result = 0;
+        for (const auto& entry : _storage)
+            result += entry.second->size();
+        return result;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
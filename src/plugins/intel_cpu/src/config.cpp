@@ -64,6 +64,9 @@ void Config::applyDebugCapsProperties() {
     // always enable perf counters for verbose mode and performance summary
     if (!debugCaps.verbose.empty() || !debugCaps.summaryPerf.empty())
         collectPerfCounters = true;
+    // the hardware counters of all the threads are summed up, so the numbers of the streams would be mixed up
+    if (!debugCaps.hwCounters.empty())
+        streamExecutorConfig._streams = 1;
 }
 #endif
 
@@ -188,6 +191,33 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (CPUConfigParams::KEY_CPU_STREAMS_AUTO_TUNING == key) {
+            if (val == PluginConfigParams::YES)
+                streamsAutoTuning = true;
+            else if (val == PluginConfigParams::NO)
+                streamsAutoTuning = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_STREAMS_AUTO_TUNING
+                           << ". Expected only YES/NO";
+        } else if (CPUConfigParams::KEY_CPU_MEMORY_BUDGET == key) {
+            long long val_i = -1;
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                val_i = -1;
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_BUDGET
+                           << ". Expected only non-negative integer numbers";
+            memoryBudget = static_cast<uint64_t>(val_i);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT) {
+            if (val == PluginConfigParams::YES)
+                layoutAssignment = true;
+            else if (val == PluginConfigParams::NO)
+                layoutAssignment = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT
+                           << ". Expected only YES/NO";
         } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
             if (val == PluginConfigInternalParams::ENABLE)
                 snippetsMode = SnippetsMode::Enable;
@@ -244,6 +274,11 @@ void Config::updateProperties() {
     else
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+    _config.insert({ CPUConfigParams::KEY_CPU_STREAMS_AUTO_TUNING,
+                     streamsAutoTuning ? PluginConfigParams::YES : PluginConfigParams::NO });
+
+    _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_BUDGET, std::to_string(memoryBudget) });
+
     _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
 
     _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
@@ -41,11 +41,15 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool streamsAutoTuning = false;
+    bool layoutAssignment = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot = "";
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    // the upper bound of the memory footprint in bytes, zero means no limit
+    uint64_t memoryBudget = 0;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
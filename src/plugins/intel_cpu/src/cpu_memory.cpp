@@ -199,6 +199,10 @@ bool MemoryMngrWithReuse::hasExtBuffer() const noexcept {
     return _useExternalStorage;
 }
 
+size_t MemoryMngrWithReuse::getSize() const noexcept {
+    return _memUpperBound;
+}
+
 void MemoryMngrWithReuse::release(void *ptr) {}
 
 void MemoryMngrWithReuse::destroy(void *ptr) {
@@ -226,6 +230,10 @@ bool DnnlMemoryMngr::hasExtBuffer() const noexcept {
     return _pMemMngr->hasExtBuffer();
 }
 
+size_t DnnlMemoryMngr::getSize() const noexcept {
+    return _pMemMngr->getSize();
+}
+
 void DnnlMemoryMngr::registerMemory(Memory* memPtr) {
     if (memPtr) {
         _setMemPtrs.insert(memPtr);
@@ -67,6 +67,12 @@ public:
      * @return status whether the object has control over underlying memory buffer
      */
     virtual bool hasExtBuffer() const noexcept = 0;
+
+    /**
+     * @brief Accessor to the size of underlying memory buffer
+     * @return size of the memory buffer in bytes
+     */
+    virtual size_t getSize() const noexcept = 0;
 };
 
 /**
@@ -79,6 +85,7 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
+    size_t getSize() const noexcept override;
 
 private:
     bool _useExternalStorage = false;
@@ -99,6 +106,7 @@ public:
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
+    size_t getSize() const noexcept override;
     void registerMemory(Memory* memPtr);
     void unregisterMemory(Memory* memPtr);
 
@@ -27,6 +27,10 @@ public:
         mem->Create(md, mgrPtr);
         return mem;
     }
+
+    size_t size() const {
+        return mgrPtr->getSize();
+    }
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
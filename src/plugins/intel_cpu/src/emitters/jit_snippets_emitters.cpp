@@ -255,15 +255,26 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params, boo
 
         return strides;
     };
-    for (size_t i = 0; i < num_params; i++) {
-        data_offsets[i] = offset_calculation(io_shapes[i],  data_layout[i], io_data_size[i]);
+    if (!jcp.has_runtime_offsets) {
+        for (size_t i = 0; i < num_params; i++) {
+            data_offsets[i] = offset_calculation(io_shapes[i],  data_layout[i], io_data_size[i]);
+        }
+    } else if (offset_rank > SNIPPETS_MAX_HARNESS_DIMS) {
+        IE_THROW() << "KernelEmitter supports runtime offsets only for up to " << SNIPPETS_MAX_HARNESS_DIMS << " scheduled dims";
     }
+    auto runtime_offset = [&](size_t i, size_t j) {
+        return GET_OFF(data_offsets) + (i * SNIPPETS_MAX_HARNESS_DIMS + j) * sizeof(int64_t);
+    };
     // master_shape size must be valid in both static and dynamic cases
-    std::function<void(Reg64, const std::vector<size_t>&, Reg64)> init_ptr_with_offset;
-    init_ptr_with_offset = [&](Reg64 pointer, const std::vector<size_t>& offsets, Reg64 reg_tmp) {
+    std::function<void(Reg64, size_t, Reg64)> init_ptr_with_offset;
+    init_ptr_with_offset = [&](Reg64 pointer, size_t i, Reg64 reg_tmp) {
         for (int j = 0; j < offset_rank; j++) {
-            if (jcp.master_shape[j] != 1 && offsets[j] != 0) {
-                h->mov(reg_tmp, offsets[j]);
+            if (jcp.has_runtime_offsets) {
+                h->mov(reg_tmp, h->ptr[reg_const_params + runtime_offset(i, j)]);
+                h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(pointer, reg_tmp);
+            } else if (jcp.master_shape[j] != 1 && data_offsets[i][j] != 0) {
+                h->mov(reg_tmp, data_offsets[i][j]);
                 h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
                 h->add(pointer, reg_tmp);
             }
@@ -287,7 +298,7 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params, boo
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
         else
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        init_ptr_with_offset(data_ptr_regs[i], i, reg_tmp);
     }
     // a rare case when num_params is maximal, so we have no spare gprs
     // * Static case: we can use reg_const_params as the last reg_tmp for the last iteration (and corrupt it), since
@@ -297,8 +308,20 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params, boo
     if (last_iter_explicitly) {
         h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
         reg_tmp = reg_const_params;
-        // can corrupt reg_const_params, since we won't use it anymore
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        if (jcp.has_runtime_offsets) {
+            // the offsets are addressed by reg_const_params itself, so keep its value on the stack
+            h->push(reg_const_params);
+            for (size_t j = 0; j < offset_rank; j++) {
+                h->mov(reg_tmp, h->ptr[h->rsp]);
+                h->mov(reg_tmp, h->ptr[reg_tmp + runtime_offset(i, j)]);
+                h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+                h->add(data_ptr_regs[i], reg_tmp);
+            }
+            h->pop(reg_const_params);
+        } else {
+            // can corrupt reg_const_params, since we won't use it anymore
+            init_ptr_with_offset(data_ptr_regs[i], i, reg_tmp);
+        }
     }
 }
 void KernelEmitter::emit_impl(const std::vector<size_t>& in,
@@ -34,11 +34,18 @@ struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    // Byte strides of the dimensions scheduled by the plugin (all but the last one) per every input and output.
+    // Used only if the kernel is compiled with has_runtime_offsets, zero stride means broadcasting.
+    // Not initialized: the node copies the rows of all inputs and outputs before every call
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS][SNIPPETS_MAX_HARNESS_DIMS];
 };
 
 struct jit_snippets_compile_args {
     std::vector<size_t> master_shape{};
     size_t tile_rank = 0;
+    // If true, data offsets are read from jit_snippets_call_args, so the kernel depends only on the tile dimensions
+    // and can be reused for any shape of the outer dimensions (dynamic shapes)
+    bool has_runtime_offsets = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (for example, KernelEmitter)
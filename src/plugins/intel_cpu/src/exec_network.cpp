@@ -27,6 +27,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -95,6 +96,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
+    if (_cfg.memoryBudget != 0) {
+        fitMemoryBudget();
+    }
+
     if (cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = _plugin->executorManager()->getExecutor("CPU");
@@ -180,15 +185,14 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 GraphContext::Ptr ctx;
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
+                    if (_shareWeightsAcrossNuma)
+                        numaNodeId = getAvailableNUMANodes().front();
                     // disable weights caching if graph was created only once
                     auto weightsCache =
                         _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
 
-                    auto isQuantizedFlag =
-                        (_cfg.lpTransformsMode == Config::On) &&
-                        ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
-
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantized(),
+                                                         numaNodeId);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -207,6 +211,86 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     return graphLock;
 }
 
+bool ExecNetwork::isQuantized() const {
+    return (_cfg.lpTransformsMode == Config::On) &&
+           ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
+}
+
+void ExecNetwork::fitMemoryBudget() {
+    // the probe graph fills its own weights cache the same way as the graphs of the streams fill the shared one
+    std::unordered_set<const void*> counted;
+    MemoryFootprint footprint;
+    uint64_t sharedWeights = 0;
+    {
+        auto weightsCache = std::make_shared<WeightsSharing>();
+        auto ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantized());
+        Graph probe;
+        probe.CreateGraph(_network, ctx);
+        sharedWeights = weightsCache->footprint(counted);
+        probe.getMemoryFootprint(footprint, counted);
+        sharedWeights += footprint.packedWeights;
+    }
+
+    // a single stream doesn't use the per network weights cache, but owns the same weights
+    const uint64_t streamMemory = footprint.weights + footprint.activations + footprint.scratchpad;
+    auto estimate = [&](int streams, int weightsCopies) {
+        return sharedWeights * weightsCopies + streamMemory * streams;
+    };
+
+    const int numaNodes = static_cast<int>(std::max<size_t>(getAvailableNUMANodes().size(), 1));
+    const int requestedStreams = std::max(1, _cfg.streamExecutorConfig._streams);
+    const auto budget = _cfg.memoryBudget;
+    int streams = requestedStreams;
+    for (; streams > 0; streams--) {
+        const int weightsCopies = std::min(streams, numaNodes);
+        if (estimate(streams, weightsCopies) <= budget)
+            break;
+        // the remote access to the weights is cheaper than the loss of the streams
+        if (weightsCopies > 1 && estimate(streams, 1) <= budget) {
+            _shareWeightsAcrossNuma = true;
+            break;
+        }
+    }
+
+    if (streams == 0) {
+        IE_THROW() << "The estimated memory footprint of a single stream of " << _name << " is " << estimate(1, 1)
+                   << " bytes, which exceeds the memory budget of " << budget << " bytes";
+    }
+
+    if (streams != requestedStreams) {
+        auto& executorConfig = _cfg.streamExecutorConfig;
+        executorConfig._streams = streams;
+        // the split between the big and the small cores is recalculated for the new number of streams
+        executorConfig._big_core_streams = 0;
+        executorConfig._small_core_streams = 0;
+        executorConfig._threads_per_stream_big = 0;
+        executorConfig._threads_per_stream_small = 0;
+        _cfg._config[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(streams);
+    }
+}
+
+std::map<std::string, uint64_t> ExecNetwork::getMemoryFootprint() const {
+    std::unordered_set<const void*> counted;
+    uint64_t sharedWeights = _numaNodesWeights.footprint(counted);
+    MemoryFootprint footprint;
+    for (auto& graph : _graphs) {
+        GraphGuard::Lock lock(graph);
+        if (graph.IsReady())
+            graph.getMemoryFootprint(footprint, counted);
+    }
+    sharedWeights += footprint.packedWeights;
+
+    return {
+        {"shared_weights", sharedWeights},
+        {"stream_weights", footprint.weights},
+        {"activations", footprint.activations},
+        {"scratchpads", footprint.scratchpad},
+        {"total", sharedWeights + footprint.weights + footprint.activations + footprint.scratchpad},
+        {"streams", _graphs.size()},
+        {"runtime_cache_entries", footprint.runtimeCacheEntries},
+    };
+}
+
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
     return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
 }
@@ -283,11 +367,26 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+    // all the graphs are locked to collect the footprint, so the graph of the current stream is not locked yet
+    if (name == ov::intel_cpu::memory_footprint) {
+        return decltype(ov::intel_cpu::memory_footprint)::value_type(getMemoryFootprint());
+    }
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
     const auto& config = graph.getConfig();
 
+    // the graphs of all the streams are made by the same assignment
+    if (name == ov::intel_cpu::layout_assignment_report) {
+        const auto& report = graph.getLayoutAssignmentReport();
+        return decltype(ov::intel_cpu::layout_assignment_report)::value_type{
+            {"reorders_before", report.reordersBefore},
+            {"reorders_after", report.reordersAfter},
+            {"reorders_eliminated", report.reordersBefore - report.reordersAfter},
+            {"changed_nodes", report.changedNodes},
+        };
+    }
+
     if (isLegacyAPI()) {
         return GetMetricLegacy(name, graph);
     }
@@ -309,6 +408,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::execution_devices.name()),
+            RO_property(ov::intel_cpu::memory_footprint.name()),
+            RO_property(ov::intel_cpu::layout_assignment_report.name()),
         };
     }
 
@@ -69,6 +69,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // all the streams use the weights cache of the first NUMA node to fit the memory budget
+    bool                                        _shareWeightsAcrossNuma = false;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -81,6 +83,16 @@ protected:
 
     bool isLegacyAPI() const;
 
+    bool isQuantized() const;
+
+    /**
+     * @brief Estimates the memory footprint of a stream by the compilation of a probe graph and reduces
+     * the number of streams to fit the memory budget
+     */
+    void fitMemoryBudget();
+
+    std::map<std::string, uint64_t> getMemoryFootprint() const;
+
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
@@ -69,6 +69,7 @@ typedef std::vector<edge_cluster_t> edge_clusters_t;
 
 Graph::~Graph() {
     CPU_DEBUG_CAP_ENABLE(summary_perf(*this));
+    CPU_DEBUG_CAP_ENABLE(hwCounters.summary(GetName()));
 }
 
 template<typename NET>
@@ -460,6 +461,12 @@ void Graph::InitDescriptors() {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    layoutAssignmentReport = {};
+    if (getConfig().layoutAssignment) {
+        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "AssignLayouts");
+        layoutAssignmentReport = AssignLayouts(graphNodes);
+    }
 }
 
 void Graph::InitOptimalPrimitiveDescriptors() {
@@ -757,7 +764,8 @@ void Graph::AllocateWithReuse() {
     }
 
     MemorySolver staticMemSolver(definedBoxes);
-    size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+    // the workspace lives as long as the graph, so it's worth trying all the packing heuristics
+    size_t total_size = static_cast<size_t>(staticMemSolver.solve(true)) * alignment;
 
     memWorkspace = std::make_shared<Memory>(getEngine());
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
@@ -870,6 +878,49 @@ void Graph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    ResolveBindableOutputs();
+}
+
+void Graph::ResolveBindableOutputs() {
+    bindableOutputs.clear();
+
+    // Redirecting the memory of the edge to the user tensor redirects all the edges sharing its memory manager:
+    // the edges of the same cluster and the in-place views resolved on top of them.
+    // It holds for the static memory placed in the workspace only, the dynamic memory manager is replaced instead.
+    std::unordered_map<const DnnlMemoryMngr*, std::vector<EdgePtr>> edgesByMngr;
+    for (const auto& edge : graphEdges) {
+        if (edge->getStatus() == Edge::Status::Validated)
+            edgesByMngr[edge->getMemoryPtr()->getDnnlMemoryMngr().get()].push_back(edge);
+    }
+
+    for (const auto& output : outputNodesMap) {
+        const auto parentEdge = output.second->getParentEdgeAt(0);
+        if (parentEdge->getStatus() != Edge::Status::Validated || parentEdge->getParent()->isConstant())
+            continue;
+        const auto& outMem = parentEdge->getMemory();
+        if (!outMem.getDesc().isDefined() || !outMem.getDnnlMemoryMngr()->hasExtBuffer())
+            continue;
+
+        const auto outSize = outMem.GetSize();
+        const auto outPtr = outMem.GetData();
+        const auto& edges = edgesByMngr[outMem.getDnnlMemoryMngr().get()];
+        // The user tensor replaces the whole buffer, so every edge on it has to start at its beginning without an offset
+        // and fit into the output.
+        // The graph inputs and states keep their own data between the inferences, so they cannot live in the user output.
+        const bool bindable = std::all_of(edges.begin(), edges.end(), [&](const EdgePtr& edge) {
+            const auto& mem = edge->getMemory();
+            const auto parentType = edge->getParent()->getType();
+            return !edge->getParent()->isConstant() &&
+                   !one_of(parentType, Type::Input, Type::MemoryInput) &&
+                   edge->getChild()->getType() != Type::MemoryOutput &&
+                   mem.getDesc().isDefined() &&
+                   mem.GetPtr() == outPtr &&
+                   mem.GetSize() <= outSize;
+        });
+        if (bindable)
+            bindableOutputs.insert(output.first);
+    }
 }
 
 void Graph::CreatePrimitives() {
@@ -901,6 +952,13 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
         const void *ext_data_ptr = in->cbuffer();
         void *inter_data_ptr = childEdge->getMemory().GetData();
 
+        auto normalizePreproc = _normalizePreprocMap.find(name);
+        const bool withNormalize = normalizePreproc != _normalizePreprocMap.end();
+        if (withNormalize && inTensorDesc.getPrecision() != InferenceEngine::Precision::FP32) {
+            IE_THROW() << "Mean image of type " << inTensorDesc.getPrecision().name() << " is unsupported";
+        }
+
+        bool normalized = false;
         if (ext_data_ptr != inter_data_ptr) {
             auto ext_tdesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(in->getTensorDesc());
 
@@ -917,19 +975,19 @@ void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::
                 tmpMem.Create(newDesc, childEdge->getMemory().GetData(), false);
 
                 tmpMem.SetData(ext_mem, false);
+            } else if (withNormalize && ext_mem.getDesc().isCompatible(childEdge->getMemory().getDesc())) {
+                // the normalization reads the external blob directly, so the input is copied only once
+                normalizePreproc->second.NormalizeImage(outDims, reinterpret_cast<const float *>(ext_data_ptr),
+                                                        reinterpret_cast<float *>(inter_data_ptr), inTensorDesc.getLayout());
+                normalized = true;
             } else {
                 childEdge->getMemory().SetData(ext_mem, false);
             }
         }
 
-        // todo: make sure 'name' exists in this map...
-        if (_normalizePreprocMap.find(name) != _normalizePreprocMap.end()) {
-            if (inTensorDesc.getPrecision() == InferenceEngine::Precision::FP32) {
-                _normalizePreprocMap[name].NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
-                                                          inTensorDesc.getLayout());
-            } else {
-                IE_THROW() << "Mean image of type " << inTensorDesc.getPrecision().name() << " is unsupported";
-            }
+        if (withNormalize && !normalized) {
+            normalizePreproc->second.NormalizeImage(outDims, reinterpret_cast<float *>(inter_data_ptr),
+                                                    inTensorDesc.getLayout());
         }
     } else {
         IE_THROW() << "Input blob for infer '" << name << "' doesn't correspond to input in network";
@@ -940,9 +998,11 @@ void Graph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         IE_THROW() << "Wrong state. Topology not ready.";
 
+    outputCopiedBytes.clear();
     for (auto &outputMap : outputNodesMap) {
         auto name = outputMap.first;
         auto node = outputMap.second;
+        PERF(node, getConfig().collectPerfCounters);
         auto parentEdge = node->getParentEdgeAt(0);
         const Memory& intr_blob = parentEdge->getMemory();
 
@@ -997,7 +1057,10 @@ void Graph::PullOutputData(BlobMap &out) {
         void *intr_blob_ptr = intr_blob.GetData();
 
         // That is the same memory. No need to copy
-        if (ext_blob_ptr == intr_blob_ptr) continue;
+        if (ext_blob_ptr == intr_blob_ptr) {
+            outputCopiedBytes[node.get()] = 0;
+            continue;
+        }
 
         if (actualDesc.getBlockingDesc() != expectedDesc.getBlockingDesc() && !isScalarOutput) {
             // User can initialize output via SetOutput API using tensorDesc with ANY layout.
@@ -1021,6 +1084,7 @@ void Graph::PullOutputData(BlobMap &out) {
             } else {
                 outBloMem.SetData(intr_blob, false);
             }
+            outputCopiedBytes[node.get()] = outBloMem.GetSize();
         } else {
             size_t size_to_copy = intr_blob.GetDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
             // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
@@ -1034,6 +1098,7 @@ void Graph::PullOutputData(BlobMap &out) {
             }
 
             cpu_convert(intr_blob_ptr, ext_blob_ptr, srcPrec, dstPrec, size_to_copy);
+            outputCopiedBytes[node.get()] = size_to_copy * dstPrec.size();
         }
     }
 }
@@ -1143,6 +1208,7 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DUMP(node, getConfig().debugCaps, infer_count);
 
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
+    HW_COUNTERS(hwCounters, node);
 
     if (node->isDynamicNode()) {
         node->executeDynamic(stream);
@@ -1157,6 +1223,8 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    CPU_DEBUG_CAP_ENABLE(hwCounters.startInfer(getConfig().debugCaps.hwCounters));
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
@@ -1254,6 +1322,40 @@ void Graph::SortTopologically() {
     }
 }
 
+void Graph::getMemoryFootprint(MemoryFootprint& footprint, std::unordered_set<const void*>& counted) const {
+    auto countWeights = [&](const MemoryCPtr& memory, uint64_t& weights) {
+        if (memory && memory->isAllocated() && memory->getDesc().isDefined() && counted.insert(memory->GetData()).second)
+            weights += memory->GetSize();
+    };
+
+    for (const auto& edge : graphEdges) {
+        const auto& memory = edge->getMemoryPtr();
+        if (edge->getParent()->isConstant()) {
+            countWeights(memory, footprint.weights);
+            continue;
+        }
+        // the static tensors are the external buffers over the workspace, the dynamic ones own their buffers
+        const auto memMngr = memory ? memory->getDnnlMemoryMngr() : nullptr;
+        if (!memMngr || memMngr->hasExtBuffer() || !memMngr->getRawPtr())
+            continue;
+        if (counted.insert(memMngr->getRawPtr()).second)
+            footprint.activations += memMngr->getSize();
+    }
+
+    for (const auto& node : graphNodes) {
+        for (const auto& memory : node->getInternalMemory())
+            countWeights(memory, footprint.packedWeights);
+    }
+
+    if (memWorkspace && counted.insert(memWorkspace->GetData()).second)
+        footprint.activations += memWorkspace->GetSize();
+
+    const auto scratchPad = context->getScratchPad();
+    if (scratchPad && counted.insert(scratchPad.get()).second)
+        footprint.scratchpad += scratchPad->size();
+    footprint.runtimeCacheEntries += context->getParamsCache()->size();
+}
+
 void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const NodePtr&)>
@@ -1284,6 +1386,22 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
             continue;
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    // the copy of the outputs to the user tensors has its own counter, the exec type tells the bytes copied
+    for (const auto& output : outputNodesMap) {
+        const auto copied = outputCopiedBytes.find(output.second.get());
+        if (copied == outputCopiedBytes.end())
+            continue;
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap[output.second->getName() + "_copy"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = pc.realTime_uSec = 0;
+        pc.status = copied->second ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                   : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        const std::string copyType = copied->second ? "copy_" + std::to_string(copied->second) + "_bytes" : "zero_copy";
+        copyType.copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]), 0);
+        const std::string layerType = "OutputCopy";
+        layerType.copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]), 0);
+    }
 }
 
 void Graph::RemoveEdge(EdgePtr& edge) {
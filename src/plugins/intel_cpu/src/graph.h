@@ -13,11 +13,15 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "layout_assignment.h"
+#include "utils/hw_counters.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ov {
 namespace intel_cpu {
@@ -25,6 +29,17 @@ namespace intel_cpu {
 class InferRequestBase;
 class InferRequest;
 
+struct MemoryFootprint {
+    // the constants
+    uint64_t weights = 0;
+    // the weights repacked by the nodes, they are shared by all the compiled models of the process
+    uint64_t packedWeights = 0;
+    // the workspace of the static tensors and the buffers of the dynamic ones
+    uint64_t activations = 0;
+    uint64_t scratchpad = 0;
+    uint64_t runtimeCacheEntries = 0;
+};
+
 class Graph {
 public:
     typedef std::shared_ptr<Graph> Ptr;
@@ -105,6 +120,15 @@ public:
         return outputNodesMap.count(name);
     }
 
+    /**
+     * @brief Checks if the memory of the output may be replaced by the user memory, so the nodes producing the output
+     * write into the user tensor directly and PullOutputData doesn't copy it.
+     * The nodes with the body graphs use it to write the body outputs into the outer buffers.
+     */
+    bool isOutputBindable(const std::string& name) const {
+        return bindableOutputs.count(name);
+    }
+
     dnnl::engine getEngine() const {
         return context->getEngine();
     }
@@ -115,6 +139,17 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Adds the memory allocated by the graph to the footprint. Every buffer is counted once,
+     * so the buffers from the counted set (e.g. the weights shared with the other graphs) are skipped.
+     * The memory bound to the user tensors is not counted.
+     */
+    void getMemoryFootprint(MemoryFootprint& footprint, std::unordered_set<const void*>& counted) const;
+
+    const LayoutAssignmentReport& getLayoutAssignmentReport() const {
+        return layoutAssignmentReport;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -202,6 +237,8 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        bindableOutputs.clear();
+        outputCopiedBytes.clear();
     }
     Status status { Status::NotReady };
 
@@ -230,6 +267,7 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void ResolveBindableOutputs();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
@@ -255,8 +293,18 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    std::unordered_set<std::string> bindableOutputs;
+    // bytes copied to the user tensors by the last PullOutputData call, zero means the output was written in place
+    std::unordered_map<const Node*, size_t> outputCopiedBytes;
+
+    LayoutAssignmentReport layoutAssignmentReport;
+
     GraphContext::CPtr context;
 
+#ifdef CPU_DEBUG_CAPS
+    mutable HwCountersCollector hwCounters;
+#endif
+
     void EnforceBF16();
 };
 
@@ -10,6 +10,8 @@
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
 
+#include <ie_system_conf.h>
+
 namespace ov {
 namespace intel_cpu {
 
@@ -22,12 +24,16 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 int numaNodeId = -1)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
           sharedMutex(sharedMutex),
           isGraphQuantizedFlag(isGraphQuantized) {
+        packedWeightsCache = NumaNodesWeights::packedWeights()[numaNodeId < 0
+                                                                   ? InferenceEngine::getAvailableNUMANodes().front()
+                                                                   : numaNodeId];
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
@@ -44,6 +50,10 @@ public:
         return weightsCache;
     }
 
+    WeightsSharing::Ptr getPackedWeightsCache() const {
+        return packedWeightsCache;
+    }
+
     std::shared_ptr<std::mutex> getSharedMutex() const {
         return sharedMutex;
     }
@@ -69,6 +79,7 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsSharing::Ptr packedWeightsCache;   // process-wide cache of the repacked weights on the NUMA node
     std::shared_ptr<std::mutex> sharedMutex;  // mutex for protection of type-relaxed Op in clone_model()
 
     MultiCachePtr rtParamsCache;     // primitive cache
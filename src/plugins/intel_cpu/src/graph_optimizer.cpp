@@ -20,6 +20,8 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -73,6 +75,18 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     MergeConvertAndScaleShift(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeConvertAndColorConvert");
+    MergeConvertAndColorConvert(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndTableDecompression");
+    FuseEmbeddingBagAndTableDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -141,6 +155,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNormalizeL2AndSimpleOperation");
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -545,6 +563,275 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     }
 }
 
+// Preprocessing lowers u8 -> f32 conversion of the camera image into Convert nodes before the color conversion.
+// ColorConvert reads the u8 planes directly and produces f32 output instead, so the f32 planes are never materialized.
+void GraphOptimizer::MergeConvertAndColorConvert(Graph& graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](NodePtr node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               node->getParentEdges().size() == 1 &&
+               node->getOriginalInputPrecisionAtPort(0) == Precision::U8 &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    for (auto& node : graphNodes) {
+        if (node->getType() != Type::ColorConvert)
+            continue;
+
+        std::vector<NodePtr> converts;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto parentNode = node->getParentEdgesAtPort(i)[0]->getParent();
+            if (!isSuitableConvertNode(parentNode))
+                break;
+            converts.push_back(parentNode);
+        }
+        // all the planes must have the same precision
+        if (converts.empty() || converts.size() != node->getParentEdges().size())
+            continue;
+
+        for (size_t i = 0; i < converts.size(); i++) {
+            node->setOriginalInputPrecisionAtPort(i, Precision::U8);
+            node->addOriginalLayer(converts[i]->getOriginalLayers());
+            graph.DropNode(converts[i]);
+        }
+    }
+}
+
+// The compressed embedding table is kept as i8/u8 (or bf16) constant followed by Convert to fp32
+// and the optional multiplication by the scale, which is either common or per row of the table.
+// The EmbeddingBag kernels read the compressed rows and dequantize them on the fly, so the fp32 table is never materialized.
+void GraphOptimizer::FuseEmbeddingBagAndTableDecompression(Graph& graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    if (!EmbeddingBagSum::isTableDecompressionSupported())
+        return;
+
+    auto isSuitableConvertNode = [](NodePtr node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               node->getParentEdges().size() == 1 &&
+               one_of(node->getOriginalInputPrecisionAtPort(0), Precision::I8, Precision::U8, Precision::BF16) &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    };
+
+    auto isSuitableScaleNode = [](NodePtr node, NodePtr tableNode) {
+        if (node->getType() != Type::Eltwise || node->getAlgorithm() != Algorithm::EltwiseMultiply ||
+            node->getChildEdges().size() != 1 || node->getParentEdges().size() != 2 || !node->getFusedWith().empty())
+            return false;
+        const auto scaleNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (scaleNode->getType() != Type::Input || !scaleNode->isConstant() ||
+            scaleNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& tableShape = tableNode->getOutputShapeAtPort(0);
+        const auto& scaleShape = node->getInputShapeAtPort(1);
+        if (!tableShape.isStatic() || !scaleShape.isStatic())
+            return false;
+        // the scale is common for the whole table or per row
+        const auto& scaleDims = scaleShape.getStaticDims();
+        if (scaleShape.getElementsCount() == 1)
+            return true;
+        return scaleDims.size() == tableShape.getRank() && scaleDims[0] == tableShape.getStaticDims()[0] &&
+               scaleShape.getElementsCount() == scaleDims[0];
+    };
+
+    for (auto& node : graphNodes) {
+        if (!one_of(node->getType(), Type::EmbeddingBagOffsetsSum, Type::EmbeddingBagPackedSum, Type::EmbeddingSegmentsSum))
+            continue;
+        auto embeddingBag = std::dynamic_pointer_cast<EmbeddingBagSum>(node);
+        if (!embeddingBag)
+            continue;
+
+        auto parentNode = node->getParentEdgesAtPort(0)[0]->getParent();
+        NodePtr scaleNode;
+        if (parentNode->getType() == Type::Eltwise) {
+            auto convertNode = parentNode->getParentEdgesAtPort(0)[0]->getParent();
+            if (!isSuitableConvertNode(convertNode) || !isSuitableScaleNode(parentNode, convertNode))
+                continue;
+            scaleNode = parentNode;
+            parentNode = convertNode;
+        }
+        if (!isSuitableConvertNode(parentNode) || !parentNode->getParentEdgesAtPort(0)[0]->getParent()->isConstant())
+            continue;
+
+        std::vector<float> scales;
+        bool perRowScales = false;
+        if (scaleNode) {
+            auto scaleConstant = dynamic_cast<node::Input*>(scaleNode->getParentEdgesAtPort(1)[0]->getParent().get());
+            if (scaleConstant == nullptr)
+                IE_THROW() << "Cannot cast to Input node";
+            auto scaleData = static_cast<const float*>(scaleConstant->getMemoryPtr()->GetPtr());
+            const auto scalesNum = scaleNode->getInputShapeAtPort(1).getElementsCount();
+            scales.assign(scaleData, scaleData + scalesNum);
+            perRowScales = scalesNum > 1;
+
+            for (auto& parentEdge : scaleNode->getParentEdges()) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent() == parentNode)
+                    continue;
+                graph.RemoveEdge(p_edge);
+            }
+            node->addOriginalLayer(scaleNode->getOriginalLayers());
+            graph.DropNode(scaleNode);
+        }
+
+        embeddingBag->fuseTableDecompression(scales, perRowScales);
+        node->setOriginalInputPrecisionAtPort(0, parentNode->getOriginalInputPrecisionAtPort(0));
+        node->addOriginalLayer(parentNode->getOriginalLayers());
+        graph.DropNode(parentNode);
+    }
+}
+
+// The compressed weights of FullyConnected are kept as i8/u8 constant followed by Convert to fp32, the optional subtraction
+// of the zero point and the multiplication by the scale (see MarkMatMulWeightsDecompression). The scale and the zero point
+// are per output channel or per group of the input channels, the grouped weights [N, G, K / G] are reshaped to [N, K].
+// FullyConnected dequantizes the weights inside of the kernel, so the fp32 weights are never materialized.
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph& graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableConvertNode = [](NodePtr node) {
+        return node->getType() == Type::Convert && node->getChildEdges().size() == 1 &&
+               node->getParentEdges().size() == 1 && node->getParentEdgesAtPort(0)[0]->getParent()->isConstant() &&
+               one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+    };
+
+    auto isSuitableEltwiseNode = [](NodePtr node, Algorithm algorithm) {
+        return node->getType() == Type::Eltwise && node->getAlgorithm() == algorithm &&
+               node->getChildEdges().size() == 1 && node->getParentEdges().size() == 2 && node->getFusedWith().empty() &&
+               node->getParentEdgesAtPort(1)[0]->getParent()->isConstant();
+    };
+
+    // The scale or the zero point is the constant, which is optionally converted from the integer precision
+    auto getParameterConstant = [](NodePtr eltwise) {
+        auto parent = eltwise->getParentEdgesAtPort(1)[0]->getParent();
+        if (parent->getType() == Type::Convert && parent->getParentEdges().size() == 1)
+            parent = parent->getParentEdgesAtPort(0)[0]->getParent();
+        return parent;
+    };
+
+    // The parameter is broadcasted to [N, groupsNum] values, the empty vector is returned for unsupported shapes
+    auto readParameter = [&getParameterConstant](NodePtr eltwise, const VectorDims& weightsDims) {
+        std::vector<float> values;
+        const auto parent = getParameterConstant(eltwise);
+        auto constant = dynamic_cast<node::Input*>(parent.get());
+        const auto& shape = eltwise->getInputShapeAtPort(1);
+        if (constant == nullptr || !shape.isStatic() || shape.getRank() > weightsDims.size())
+            return values;
+
+        VectorDims dims(weightsDims.size() - shape.getRank(), 1);
+        dims.insert(dims.end(), shape.getStaticDims().begin(), shape.getStaticDims().end());
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (dims[i] != 1 && (i == dims.size() - 1 || dims[i] != weightsDims[i]))
+                return values;
+        }
+
+        const size_t valuesNum = shape.getElementsCount();
+        std::vector<float> data(valuesNum);
+        cpu_convert(constant->getMemoryPtr()->GetPtr(), data.data(), parent->getOriginalOutputPrecisionAtPort(0),
+                    Precision::FP32, valuesNum);
+
+        const size_t N = weightsDims[0];
+        const size_t groupsNum = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        const size_t groupsStride = weightsDims.size() == 3 ? dims[1] : 1;
+        values.resize(N * groupsNum);
+        for (size_t n = 0; n < N; n++) {
+            for (size_t g = 0; g < groupsNum; g++)
+                values[n * groupsNum + g] = data[(dims[0] == 1 ? 0 : n) * groupsStride + (groupsStride == 1 ? 0 : g)];
+        }
+        return values;
+    };
+
+    auto removeParameter = [&graph](NodePtr eltwise) {
+        auto edge = eltwise->getParentEdgesAtPort(1)[0];
+        auto parent = edge->getParent();
+        graph.RemoveEdge(edge);
+        if (parent->getType() == Type::Convert && parent->getChildEdges().empty()) {
+            auto convertEdge = parent->getParentEdgesAtPort(0)[0];
+            graph.RemoveEdge(convertEdge);
+        }
+    };
+
+    for (auto& node : graphNodes) {
+        if (node->getType() != Type::FullyConnected)
+            continue;
+        auto fc = std::dynamic_pointer_cast<FullyConnected>(node);
+        if (!fc || fc->getParentEdges().size() < 2)
+            continue;
+        const auto& fcWeightsShape = fc->getInputShapeAtPort(1);
+        if (fcWeightsShape.getRank() != 2 || !fcWeightsShape.isStatic())
+            continue;
+
+        auto parentNode = fc->getParentEdgesAtPort(1)[0]->getParent();
+        NodePtr reshapeNode;
+        if (parentNode->getType() == Type::Reshape) {
+            if (parentNode->getChildEdges().size() != 1)
+                continue;
+            reshapeNode = parentNode;
+            parentNode = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (!isSuitableEltwiseNode(parentNode, Algorithm::EltwiseMultiply))
+            continue;
+        const auto multiplyNode = parentNode;
+        parentNode = multiplyNode->getParentEdgesAtPort(0)[0]->getParent();
+        NodePtr subtractNode;
+        if (isSuitableEltwiseNode(parentNode, Algorithm::EltwiseSubtract)) {
+            subtractNode = parentNode;
+            parentNode = subtractNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (!isSuitableConvertNode(parentNode))
+            continue;
+        const auto convertNode = parentNode;
+
+        std::vector<Precision> parametersPrecisions;
+        for (const auto& decompressionNode : { multiplyNode, subtractNode }) {
+            if (decompressionNode)
+                parametersPrecisions.push_back(getParameterConstant(decompressionNode)->getOriginalOutputPrecisionAtPort(0));
+        }
+        if (!FullyConnected::isWeightsDecompressionSupported(fc->getOriginalInputPrecisionAtPort(0),
+                                                             fc->getInputShapeAtPort(0).getRank(),
+                                                             convertNode->getOriginalInputPrecisionAtPort(0),
+                                                             parametersPrecisions))
+            continue;
+
+        const auto& weightsShape = convertNode->getInputShapeAtPort(0);
+        if (!weightsShape.isStatic() || !one_of(weightsShape.getRank(), 2, 3))
+            continue;
+        const auto& weightsDims = weightsShape.getStaticDims();
+        const auto& fcWeightsDims = fcWeightsShape.getStaticDims();
+        if (weightsDims[0] != fcWeightsDims[0] || weightsShape.getElementsCount() != fcWeightsShape.getElementsCount() ||
+            (weightsDims.size() == 2 && reshapeNode))
+            continue;
+
+        auto scales = readParameter(multiplyNode, weightsDims);
+        if (scales.empty())
+            continue;
+        std::vector<float> zeroPoints;
+        if (subtractNode) {
+            zeroPoints = readParameter(subtractNode, weightsDims);
+            if (zeroPoints.empty())
+                continue;
+        }
+
+        const auto weightsPrecision = convertNode->getOriginalInputPrecisionAtPort(0);
+        for (const auto& decompressionNode : { multiplyNode, subtractNode }) {
+            if (!decompressionNode)
+                continue;
+            removeParameter(decompressionNode);
+            fc->addOriginalLayer(decompressionNode->getOriginalLayers());
+            graph.DropNode(decompressionNode);
+        }
+        fc->addOriginalLayer(convertNode->getOriginalLayers());
+        graph.DropNode(convertNode);
+        if (reshapeNode) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+
+        const size_t groupsNum = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        fc->fuseWeightsDecompression(std::move(scales), std::move(zeroPoints), groupsNum);
+        fc->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1479,6 +1766,55 @@ void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseColorConvertAndSimpleOperation(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr node) {
+        return node->getType() == Type::ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableChildNode = [&](NodePtr parentNode, NodePtr childNode) {
+        // Avoid cycle dependencies
+        for (auto &childParentEdge : childNode->getParentEdges()) {
+            for (auto &parentParentEdge : parentNode->getParentEdges()) {
+                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
+                    return false;
+            }
+        }
+        if (!childNode->getFusedWith().empty())
+            return false;
+        return parentNode->canFuse(childNode);
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent()->getType() == Type::ColorConvert)
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -24,6 +24,9 @@ private:
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
     void MergeConvertAndScaleShift(Graph& graph);
+    void MergeConvertAndColorConvert(Graph& graph);
+    void FuseEmbeddingBagAndTableDecompression(Graph& graph);
+    void FuseFCAndWeightsDecompression(Graph& graph);
     void FuseFullyConnectedAndSimpleOperation(Graph &graph);
     void FuseMatMulAndSimpleOperation(Graph &graph);
     void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph &graph);
@@ -33,6 +36,7 @@ private:
     void FuseConvolutionSumAndConvolutionSumActivation(Graph &graph);
     void FuseMVNAndSimpleOperation(Graph &graph);
     void FuseInterpolateAndSimpleOperation(Graph &graph);
+    void FuseColorConvertAndSimpleOperation(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
 
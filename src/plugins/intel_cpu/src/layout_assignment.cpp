@@ -0,0 +1,344 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layout_assignment.h"
+
+#include "edge.h"
+#include "utils/debug_capabilities.h"
+
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// The costs are measured in bytes of the memory traffic.
+// Fixed overhead of the additional reorder node: the primitive call and the threads synchronization.
+constexpr double reorderOverhead = 16384.0;
+// Number of elements assumed for the tensors with the dynamic shapes, the layouts are compared by the reorders count then.
+constexpr double nominalElements = 65536.0;
+constexpr size_t maxSweeps = 4;
+
+double descBytes(const MemoryDescPtr& desc) {
+    if (desc->isDefined())
+        return static_cast<double>(desc->getCurrentMemSize());
+    return nominalElements * desc->getPrecision().size();
+}
+
+// Relative time of the kernel per byte of its memory traffic, the implementations are ordered the same way as
+// the greedy selector prefers them: the optimized kernels of the wider ISA, then the gemm based and the reference ones.
+double implFactor(impl_desc_type type) {
+    if (type & impl_desc_type::ref)
+        return 8.0;
+    double factor = (type & impl_desc_type::gemm) && !(type & impl_desc_type::jit) ? 2.0 : 1.0;
+    if (type & impl_desc_type::sse42)
+        factor *= 2.0;
+    else if (type & (impl_desc_type::avx | impl_desc_type::avx2))
+        factor *= 1.5;
+    return factor;
+}
+
+bool isLayoutFlexibleType(Type type) {
+    // the memory nodes and the nodes with the own selection logic (in-place concat and split) are kept as they are
+    switch (type) {
+    case Type::Input:
+    case Type::Output:
+    case Type::MemoryInput:
+    case Type::MemoryOutput:
+    case Type::Reorder:
+    case Type::Concatenation:
+    case Type::Split:
+        return false;
+    default:
+        return true;
+    }
+}
+
+bool hasInPlacePorts(const NodeConfig& config) {
+    for (const auto& conf : config.inConfs) {
+        if (conf.inPlace() >= 0)
+            return true;
+    }
+    for (const auto& conf : config.outConfs) {
+        if (conf.inPlace() >= 0)
+            return true;
+    }
+    return false;
+}
+
+bool samePrecisions(const std::vector<PortConfig>& lhs, const std::vector<PortConfig>& rhs) {
+    if (lhs.size() != rhs.size())
+        return false;
+    for (size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i].getMemDesc()->getPrecision() != rhs[i].getMemDesc()->getPrecision())
+            return false;
+    }
+    return true;
+}
+
+// Alternatives of the selected descriptor with the same precisions, they may differ by the implementation type.
+std::vector<int> layoutCandidates(const NodePtr& node) {
+    const auto selected = node->getSelectedPrimitiveDescriptor();
+    if (!selected || !isLayoutFlexibleType(node->getType()) || node->isConstant() || hasInPlacePorts(selected->getConfig()))
+        return {};
+
+    const auto& supported = node->getSupportedPrimitiveDescriptors();
+    const int selectedIdx = static_cast<int>(selected - supported.data());
+    std::vector<int> candidates{selectedIdx};
+    for (size_t i = 0; i < supported.size(); i++) {
+        const auto& pd = supported[i];
+        const auto& config = pd.getConfig();
+        if (static_cast<int>(i) == selectedIdx || pd.getImplementationType() == impl_desc_type::undef ||
+            config.inConfs.size() > node->getParentEdges().size() || hasInPlacePorts(config) ||
+            !samePrecisions(config.inConfs, selected->getConfig().inConfs) ||
+            !samePrecisions(config.outConfs, selected->getConfig().outConfs))
+            continue;
+        candidates.push_back(static_cast<int>(i));
+    }
+    return candidates.size() > 1 ? candidates : std::vector<int>{};
+}
+
+class LayoutCostModel {
+public:
+    explicit LayoutCostModel(const std::vector<NodePtr>& nodes) {
+        for (const auto& node : nodes) {
+            auto candidates = layoutCandidates(node);
+            if (candidates.empty())
+                continue;
+            flexibleIdx[node.get()] = flexible.size();
+            flexible.push_back({node, std::move(candidates), 0});
+        }
+    }
+
+    const NodeDesc* descOf(const Node* node) const {
+        auto it = flexibleIdx.find(node);
+        if (it == flexibleIdx.end())
+            return node->getSelectedPrimitiveDescriptor();
+        const auto& fn = flexible[it->second];
+        return &fn.node->getSupportedPrimitiveDescriptors()[fn.candidates[fn.current]];
+    }
+
+    const NodeDesc* candidateDesc(size_t f, size_t c) const {
+        return &flexible[f].node->getSupportedPrimitiveDescriptors()[flexible[f].candidates[c]];
+    }
+
+    // Cost of the reorder on the edge for the given descriptors of the parent and the child, zero if no reorder is needed.
+    double edgeCost(const EdgePtr& edge, const NodeDesc* parentPd, const NodeDesc* childPd) const {
+        // reorders of the constant inputs are executed once at the model loading
+        if (!parentPd || !childPd || edge->getParent()->isConstant())
+            return 0.0;
+        const auto& outConfs = parentPd->getConfig().outConfs;
+        const auto& inConfs = childPd->getConfig().inConfs;
+        int inNum = edge->getInputNum();
+        const int outNum = edge->getOutputNum();
+        if (outConfs.empty() || outNum < 0 || static_cast<size_t>(outNum) >= inConfs.size())
+            return 0.0;
+        if (inNum < 0 || static_cast<size_t>(inNum) >= outConfs.size())
+            inNum = 0;
+        const auto parentDesc = outConfs[inNum].getMemDesc();
+        const auto childDesc = inConfs[outNum].getMemDesc();
+        if (childDesc->isCompatible(*parentDesc))
+            return 0.0;
+        return reorderOverhead + descBytes(parentDesc) + descBytes(childDesc);
+    }
+
+    double kernelCost(const NodeDesc* pd) const {
+        double cost = 0.0;
+        for (const auto& conf : pd->getConfig().inConfs)
+            cost += descBytes(conf.getMemDesc());
+        for (const auto& conf : pd->getConfig().outConfs)
+            cost += descBytes(conf.getMemDesc());
+        return cost * implFactor(pd->getImplementationType());
+    }
+
+    // Kernel cost of the candidate plus the reorders on the edges, except the skipped parent and child edges.
+    double localCost(size_t f, size_t c, const Edge* skipParent = nullptr, const Edge* skipChild = nullptr) const {
+        const auto& node = flexible[f].node;
+        const auto pd = candidateDesc(f, c);
+        double cost = kernelCost(pd);
+        for (const auto& weakEdge : node->getParentEdges()) {
+            auto edge = weakEdge.lock();
+            if (edge && edge.get() != skipParent)
+                cost += edgeCost(edge, descOf(edge->getParent().get()), pd);
+        }
+        for (const auto& weakEdge : node->getChildEdges()) {
+            auto edge = weakEdge.lock();
+            if (edge && edge.get() != skipChild)
+                cost += edgeCost(edge, pd, descOf(edge->getChild().get()));
+        }
+        return cost;
+    }
+
+    // Cost of the flexible nodes and all the edges, the rest of the graph does not depend on the assignment.
+    double totalCost(const std::vector<NodePtr>& nodes) const {
+        double cost = 0.0;
+        for (size_t f = 0; f < flexible.size(); f++)
+            cost += kernelCost(candidateDesc(f, flexible[f].current));
+        for (const auto& node : nodes) {
+            for (const auto& weakEdge : node->getChildEdges()) {
+                auto edge = weakEdge.lock();
+                if (edge)
+                    cost += edgeCost(edge, descOf(node.get()), descOf(edge->getChild().get()));
+            }
+        }
+        return cost;
+    }
+
+    size_t countReorders(const std::vector<NodePtr>& nodes) const {
+        size_t count = 0;
+        for (const auto& node : nodes) {
+            for (const auto& weakEdge : node->getChildEdges()) {
+                auto edge = weakEdge.lock();
+                if (edge && edgeCost(edge, descOf(node.get()), descOf(edge->getChild().get())) > 0.0)
+                    count++;
+            }
+        }
+        return count;
+    }
+
+    struct FlexibleNode {
+        NodePtr node;
+        std::vector<int> candidates;   // indices of the supported primitive descriptors, the selected one is the first
+        size_t current;
+    };
+
+    std::vector<FlexibleNode> flexible;
+    std::unordered_map<const Node*, size_t> flexibleIdx;
+};
+
+// The single edge between the flexible nodes which is the only child edge of the parent
+// and the only non constant parent edge of the child.
+EdgePtr chainLink(const LayoutCostModel& model, size_t f) {
+    const auto& node = model.flexible[f].node;
+    if (node->getChildEdges().size() != 1)
+        return nullptr;
+    auto edge = node->getChildEdges()[0].lock();
+    if (!edge)
+        return nullptr;
+    const auto child = edge->getChild();
+    if (!model.flexibleIdx.count(child.get()))
+        return nullptr;
+    for (const auto& weakEdge : child->getParentEdges()) {
+        auto parentEdge = weakEdge.lock();
+        if (parentEdge && parentEdge != edge && !parentEdge->getParent()->isConstant())
+            return nullptr;
+    }
+    return edge;
+}
+
+void solveChains(LayoutCostModel& model) {
+    const size_t flexibleNum = model.flexible.size();
+    std::vector<EdgePtr> links(flexibleNum);
+    std::vector<bool> isLinkTarget(flexibleNum, false);
+    for (size_t f = 0; f < flexibleNum; f++) {
+        links[f] = chainLink(model, f);
+        if (links[f])
+            isLinkTarget[model.flexibleIdx.at(links[f]->getChild().get())] = true;
+    }
+
+    for (size_t head = 0; head < flexibleNum; head++) {
+        if (isLinkTarget[head] || !links[head])
+            continue;
+        std::vector<size_t> chain{head};
+        while (links[chain.back()])
+            chain.push_back(model.flexibleIdx.at(links[chain.back()]->getChild().get()));
+
+        // Viterbi over the chain: best[i][c] is the minimal cost of the prefix with the candidate c of the i-th node.
+        std::vector<std::vector<double>> best(chain.size());
+        std::vector<std::vector<size_t>> from(chain.size());
+        for (size_t i = 0; i < chain.size(); i++) {
+            const size_t f = chain[i];
+            const Edge* inLink = i > 0 ? links[chain[i - 1]].get() : nullptr;
+            const Edge* outLink = i + 1 < chain.size() ? links[f].get() : nullptr;
+            const size_t candidatesNum = model.flexible[f].candidates.size();
+            best[i].assign(candidatesNum, std::numeric_limits<double>::max());
+            from[i].assign(candidatesNum, 0);
+            for (size_t c = 0; c < candidatesNum; c++) {
+                const double local = model.localCost(f, c, inLink, outLink);
+                if (i == 0) {
+                    best[i][c] = local;
+                    continue;
+                }
+                const size_t prev = chain[i - 1];
+                for (size_t p = 0; p < model.flexible[prev].candidates.size(); p++) {
+                    const double cost = best[i - 1][p] + local +
+                                        model.edgeCost(links[prev], model.candidateDesc(prev, p), model.candidateDesc(f, c));
+                    if (cost < best[i][c]) {
+                        best[i][c] = cost;
+                        from[i][c] = p;
+                    }
+                }
+            }
+        }
+
+        size_t c = std::min_element(best.back().begin(), best.back().end()) - best.back().begin();
+        for (size_t i = chain.size(); i-- > 0;) {
+            model.flexible[chain[i]].current = c;
+            c = from[i][c];
+        }
+    }
+}
+
+void improveLocally(LayoutCostModel& model) {
+    for (size_t sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (size_t f = 0; f < model.flexible.size(); f++) {
+            auto& fn = model.flexible[f];
+            const size_t initial = fn.current;
+            double bestCost = model.localCost(f, initial);
+            for (size_t c = 0; c < fn.candidates.size(); c++) {
+                if (c == initial)
+                    continue;
+                // the candidate is evaluated with the current choice of the neighbours, the local cost includes
+                // all edges of the node, so the total cost of the graph strictly decreases on every change
+                const double cost = model.localCost(f, c);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    fn.current = c;
+                }
+            }
+            changed |= fn.current != initial;
+        }
+        if (!changed)
+            break;
+    }
+}
+
+}   // namespace
+
+LayoutAssignmentReport AssignLayouts(const std::vector<NodePtr>& nodes) {
+    LayoutAssignmentReport report;
+    LayoutCostModel model(nodes);
+    if (model.flexible.empty())
+        return report;
+
+    report.reordersBefore = model.countReorders(nodes);
+    const double greedyCost = model.totalCost(nodes);
+    solveChains(model);
+    improveLocally(model);
+
+    // the greedy choice is kept unless the assignment is cheaper
+    if (model.totalCost(nodes) >= greedyCost) {
+        report.reordersAfter = report.reordersBefore;
+        return report;
+    }
+    report.reordersAfter = model.countReorders(nodes);
+
+    for (const auto& fn : model.flexible) {
+        if (fn.current == 0)
+            continue;
+        fn.node->selectPrimitiveDescriptorByIndex(fn.candidates[fn.current]);
+        report.changedNodes++;
+        DEBUG_LOG(fn.node->getName(), " layout reassigned to the primitive descriptor ", fn.candidates[fn.current]);
+    }
+    DEBUG_LOG("Layout assignment: ", report.reordersBefore - report.reordersAfter, " of ", report.reordersBefore,
+              " reorders eliminated, ", report.changedNodes, " nodes changed");
+    return report;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,39 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+// Graph level refinement of the primitive descriptors chosen by Node::selectOptimalPrimitiveDescriptor.
+// The greedy selection looks at the parents only, so a node with the blocked consumers may keep the planar layout
+// of its input and get a reorder on every output edge. The pass reconsiders the nodes which support several layouts
+// and minimizes the total cost:
+//  - the kernel cost is the memory traffic of the node, it grows with the padding of the blocked layouts, and it is
+//    weighted by the implementation type, so a slower implementation is chosen only if it saves enough reorders;
+//  - the reorder cost is the memory traffic of the reorder plus the fixed overhead of the additional node.
+// The linear chains of such nodes are solved exactly by dynamic programming, the rest of the graph is improved
+// by the iterative local search, which never increases the cost, so the result is not worse than the greedy one.
+// The pass is experimental and runs only if the internal CPU_LAYOUT_ASSIGNMENT config key is set to YES,
+// the report is available by the ov::intel_cpu::layout_assignment_report property of the compiled model.
+
+struct LayoutAssignmentReport {
+    size_t reordersBefore = 0;
+    size_t reordersAfter = 0;
+    size_t changedNodes = 0;
+};
+
+/**
+ * @brief Reselects the primitive descriptors of the nodes after the greedy selection, before Graph::InitEdges
+ * @param nodes graph nodes in the topological order
+ */
+LayoutAssignmentReport AssignLayouts(const std::vector<NodePtr>& nodes);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -8,13 +8,33 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 #include "itt.hpp"
 
+namespace {
+
+// The compressed weights, which are dequantized inside of FullyConnected (see MarkMatMulWeightsDecompression):
+// Constant -> Convert (not folded) -> [Subtract] -> Multiply -> [Reshape]
+bool is_decompressed_weights(const ngraph::Output<ngraph::Node>& output) {
+    auto node = output.get_node();
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node))
+        node = node->get_input_node_ptr(0);
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+    node = node->get_input_node_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(node))
+        node = node->get_input_node_ptr(0);
+    return ngraph::is_type<ngraph::opset1::Convert>(node) && ov::pass::constant_folding_is_disabled(node) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+}
+
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -45,7 +65,11 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        // The compressed weights are accepted in the [N, K] form only, FullyConnected dequantizes them on the fly.
+        const bool is_constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) != nullptr;
+        const bool with_decompression = !is_constant && matmul->get_transpose_b() && rank_b == 2 &&
+                                        is_decompressed_weights(fc_input_b);
+        if (!(is_constant || with_decompression) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_embedding_table_decompression.hpp"
+
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+ov::intel_cpu::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    MATCHER_SCOPE(MarkEmbeddingTableDecompression);
+    using namespace ov::pass::pattern;
+    auto table_m = wrap_type<ov::opset1::Constant>(type_matches_any({ov::element::i8, ov::element::u8, ov::element::bf16}));
+    auto convert_m = wrap_type<ov::opset1::Convert>({table_m}, [](const ov::Output<ov::Node>& output) {
+        return consumers_count(1)(output) && type_matches(ov::element::f32)(output);
+    });
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto convert = m.get_match_root();
+        const auto table = convert->get_input_node_shared_ptr(0);
+        auto consumer = convert->get_output_target_inputs(0).begin()->get_node();
+        size_t consumer_port = convert->get_output_target_inputs(0).begin()->get_index();
+
+        // the scale must be common for the table or per row
+        if (ov::is_type<ov::opset1::Multiply>(consumer)) {
+            const auto scale = ov::as_type<ov::opset1::Constant>(consumer->get_input_node_ptr(1));
+            if (consumer_port != 0 || !scale || scale->get_output_element_type(0) != ov::element::f32 ||
+                consumer->get_output_target_inputs(0).size() != 1)
+                return false;
+            const auto& table_shape = table->get_output_shape(0);
+            const auto& scale_shape = scale->get_output_shape(0);
+            const auto scales_num = ov::shape_size(scale_shape);
+            const bool per_row = scale_shape.size() == table_shape.size() && scale_shape[0] == table_shape[0] &&
+                                 scales_num == scale_shape[0];
+            if (scales_num != 1 && !per_row)
+                return false;
+            consumer_port = consumer->get_output_target_inputs(0).begin()->get_index();
+            consumer = consumer->get_output_target_inputs(0).begin()->get_node();
+        }
+
+        if (consumer_port != 0 || !(ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(consumer) ||
+                                    ov::is_type<ov::opset3::EmbeddingBagPackedSum>(consumer) ||
+                                    ov::is_type<ov::opset3::EmbeddingSegmentsSum>(consumer)))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        return false;
+    };
+
+    auto m = std::make_shared<Matcher>(convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Keeps the compressed embedding table from constant folding. The EmbeddingBag node reads
+ *     i8/u8/bf16 rows and dequantizes them on the fly, so the table is not unpacked to fp32 in memory.
+ *
+ * Before:
+ *
+ *   Constant[i8/u8/bf16]                     Constant[i8/u8/bf16]
+ *           |                                        |
+ *     Convert[f32]          OR                 Convert[f32]    Constant (scale)
+ *           |                                        \         /
+ *      EmbeddingBag*                                  Multiply
+ *                                                        |
+ *                                                  EmbeddingBag*
+ *
+ * After:
+ *     the same, constant folding of Convert is disabled
+ */
+class MarkEmbeddingTableDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkEmbeddingTableDecompression", "0");
+    MarkEmbeddingTableDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,128 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_matmul_weights_decompression.hpp"
+
+#include <ie_ngraph_utils.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+#include "nodes/fullyconnected.h"
+
+ov::intel_cpu::MarkMatMulWeightsDecompression::MarkMatMulWeightsDecompression() {
+    MATCHER_SCOPE(MarkMatMulWeightsDecompression);
+    using namespace ov::pass::pattern;
+    auto weights_m = wrap_type<ov::opset1::Constant>(type_matches_any({ov::element::i8, ov::element::u8,
+                                                                        ov::element::i4, ov::element::u4}));
+    auto convert_m = wrap_type<ov::opset1::Convert>({weights_m}, [](const ov::Output<ov::Node>& output) {
+        return consumers_count(1)(output) && type_matches(ov::element::f32)(output);
+    });
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto convert = m.get_match_root();
+        const auto& weights_shape = convert->get_input_shape(0);
+        if (weights_shape.size() != 2 && weights_shape.size() != 3)
+            return false;
+
+        // the precisions of the CPU graph, the low and the half precisions are converted by the plugin
+        auto graph_precision = [](ov::element::Type type) {
+            if (type == ov::element::i4)
+                type = ov::element::i8;
+            else if (type == ov::element::u4)
+                type = ov::element::u8;
+            else if (type == ov::element::f16)
+                type = ov::element::f32;
+            return InferenceEngine::details::convertPrecision(type);
+        };
+        std::vector<InferenceEngine::Precision> parameters_precisions;
+
+        auto single_consumer = [](const ov::Node* node) {
+            const auto& targets = node->get_output_target_inputs(0);
+            return targets.size() == 1 ? targets.begin()->get_node() : nullptr;
+        };
+        // the scale and the zero point are per output channel or per group of the input channels
+        auto is_suitable_parameter = [&](const ov::Node* node) {
+            if (ov::is_type<ov::opset1::Convert>(node))
+                node = node->get_input_node_ptr(0);
+            if (!ov::is_type<ov::opset1::Constant>(node))
+                return false;
+            parameters_precisions.push_back(graph_precision(node->get_output_element_type(0)));
+            const auto& shape = node->get_output_shape(0);
+            if (shape.size() > weights_shape.size())
+                return false;
+            ov::Shape aligned_shape(weights_shape.size() - shape.size(), 1);
+            aligned_shape.insert(aligned_shape.end(), shape.begin(), shape.end());
+            for (size_t i = 0; i < aligned_shape.size(); i++) {
+                const bool broadcasted = aligned_shape[i] == 1 ||
+                                         (i != aligned_shape.size() - 1 && aligned_shape[i] == weights_shape[i]);
+                if (!broadcasted)
+                    return false;
+            }
+            return true;
+        };
+
+        auto node = single_consumer(convert.get());
+        if (!node)
+            return false;
+        std::shared_ptr<ov::Node> subtract;
+        if (ov::is_type<ov::opset1::Subtract>(node)) {
+            if (node->get_input_node_ptr(0) != convert.get() || !is_suitable_parameter(node->get_input_node_ptr(1)))
+                return false;
+            subtract = node->shared_from_this();
+            node = single_consumer(node);
+            if (!node)
+                return false;
+        }
+        const auto multiply_input = subtract ? subtract : convert;
+        if (!ov::is_type<ov::opset1::Multiply>(node) || node->get_input_node_ptr(0) != multiply_input.get() ||
+            !is_suitable_parameter(node->get_input_node_ptr(1)) || node->get_output_element_type(0) != ov::element::f32)
+            return false;
+        const auto multiply = node->shared_from_this();
+        const ov::Node* weights_output = multiply.get();
+        node = single_consumer(node);
+        if (!node)
+            return false;
+
+        // the grouped weights are reshaped to [N, K]
+        if (ov::is_type<ov::opset1::Reshape>(node)) {
+            const auto& shape = node->get_output_partial_shape(0);
+            if (shape.is_dynamic() || shape.size() != 2 || static_cast<size_t>(shape[0].get_length()) != weights_shape[0] ||
+                static_cast<size_t>(shape[1].get_length()) != ov::shape_size(weights_shape) / weights_shape[0])
+                return false;
+            weights_output = node;
+            node = single_consumer(node);
+            if (!node)
+                return false;
+        } else if (weights_shape.size() != 2) {
+            return false;
+        }
+
+        const auto matmul = ov::as_type<ov::opset1::MatMul>(node);
+        if (!matmul || !matmul->get_transpose_b() || matmul->get_input_node_ptr(1) != weights_output)
+            return false;
+
+        // the weights are folded when FullyConnected can't dequantize them, the activations quantized
+        // by the low precision transformations are not supported as well
+        const auto& activations_rank = matmul->get_input_partial_shape(0).rank();
+        if (activations_rank.is_dynamic() || ov::is_type<ov::opset1::FakeQuantize>(matmul->get_input_node_ptr(0)) ||
+            !ov::intel_cpu::node::FullyConnected::isWeightsDecompressionSupported(
+                graph_precision(matmul->get_input_element_type(0)),
+                activations_rank.get_length(),
+                graph_precision(convert->get_input_element_type(0)),
+                parameters_precisions))
+            return false;
+
+        ov::disable_constant_folding(convert);
+        if (subtract)
+            ov::mark_as_dequantization_node(subtract);
+        ov::mark_as_dequantization_node(multiply);
+        return false;
+    };
+
+    auto m = std::make_shared<Matcher>(convert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
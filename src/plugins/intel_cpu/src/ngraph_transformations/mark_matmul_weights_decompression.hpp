@@ -0,0 +1,44 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Keeps the compressed weights of MatMul from constant folding. The FullyConnected node reads
+ *     i8/u8 weights and dequantizes them inside of the kernel, so the weights are not unpacked to fp32 in memory.
+ *     The scale and the zero point are per output channel or per group of the input channels,
+ *     the grouped weights [N, G, K / G] are reshaped to [N, K]. Only the subgraphs which FullyConnected
+ *     supports (see FullyConnected::isWeightsDecompressionSupported) are marked, the rest are constant folded.
+ *
+ * Before:
+ *
+ *   Constant[i8/u8/i4/u4]
+ *           |
+ *     Convert[f32]
+ *           |
+ *   Subtract (zero point, optional)
+ *           |
+ *   Multiply (scale)
+ *           |
+ *   Reshape (optional)    Input
+ *            \           /
+ *          MatMul(transpose_b)
+ *
+ * After:
+ *     the same, constant folding of Convert is disabled, Subtract and Multiply are marked as dequantization nodes
+ */
+class MarkMatMulWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkMatMulWeightsDecompression", "0");
+    MarkMatMulWeightsDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
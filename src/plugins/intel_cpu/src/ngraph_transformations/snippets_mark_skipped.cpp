@@ -6,8 +6,11 @@
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <utils/general_utils.h>
 #include <utils/cpu_utils.hpp>
+#include <numeric>
 
 #include "itt.hpp"
 
@@ -157,9 +160,34 @@ int getChannelAxis(const ov::AxisSet &axes, bool keep_dims) {
     }
     return channelAxis;
 }
+// MVN over the last axis can be decomposed by Snippets and tokenized together with the surrounding eltwise ops
+// instead of being executed by MVN node with fused post ops
+bool isSuitableMVNForSnippets(const std::shared_ptr<const Node> &node) {
+    if (!ov::is_type<ngraph::op::v6::MVN>(node) || !snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node))
+        return false;
+    const auto& shape = node->get_input_shape(0);
+    if (shape.size() < 2)
+        return false;
+    // Snippets process the last two dimensions in one kernel call and parallelize over the rest ones. The decomposed MVN
+    // reads every row three times. The heuristic depends on the shape only, so the model is tokenized the same way on
+    // every machine:
+    //    parallelism work amount - not enough work amount for parallelism, unless the kernel call is as small as
+    //                              the work of one thread of MVN node, e.g. the batch-1 LayerNorm of a short sequence
+    //    kernel work amount - the row is read three times, so it should be cache-local
+    const auto parallel_work_amount = std::accumulate(shape.rbegin() + 2, shape.rend(), size_t(1), std::multiplies<size_t>());
+    const auto row_size = shape[shape.size() - 1] * node->get_input_element_type(0).size();
+    const auto kernel_buffer_size = shape[shape.size() - 2] * row_size;
+    const auto needed_num_of_threads = 12lu;
+    // L1 data cache of the cores supported by Snippets
+    const auto l1_cache_size = 32lu * 1024;
+    const auto is_unsupported_parallel_work_amount = parallel_work_amount < needed_num_of_threads &&
+                                                     kernel_buffer_size > l1_cache_size;
+    const auto is_unsupported_kernel_work_amount = row_size > l1_cache_size;
+    return !is_unsupported_parallel_work_amount && !is_unsupported_kernel_work_amount;
+}
 bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v0::MVN>(node) ||
-                                  ov::is_type<ngraph::op::v6::MVN>(node) ||
+                                  (ov::is_type<ngraph::op::v6::MVN>(node) && !isSuitableMVNForSnippets(node)) ||
                                   ov::is_type<ngraph::op::v0::NormalizeL2>(node) ||
                                   ov::is_type<ngraph::op::v0::Interpolate>(node) ||
                                   ov::is_type<ngraph::op::v4::Interpolate>(node) ||
@@ -189,6 +217,23 @@ inline bool isSuitableReduceParent(const std::shared_ptr<const Node> &node) {
     bool out_is_f32 = node->get_output_element_type(0) == ov::element::f32;
     return is_suitable_reduce && is_not_min_max && out_is_f32;
 }
+// Decompression of the compressed MatMul weights, which is fused into FullyConnected
+bool isMatMulWeightsDecompressionNode(const std::shared_ptr<const Node> &node) {
+    auto is_compressed_weights = [](const Node* node) {
+        return ov::is_type<ngraph::op::v0::Convert>(node) && ov::pass::constant_folding_is_disabled(node) &&
+               ov::is_type<ngraph::op::v0::Constant>(node->get_input_node_ptr(0));
+    };
+    if (is_compressed_weights(node.get()))
+        return true;
+    const auto& rt_info = node->get_rt_info();
+    if (!(ov::is_type<ngraph::op::v1::Subtract>(node) || ov::is_type<ngraph::op::v1::Multiply>(node)) ||
+        rt_info.find(ov::DequantizationNode::get_type_info_static()) == rt_info.end())
+        return false;
+    auto parent = node->get_input_node_ptr(0);
+    if (ov::is_type<ngraph::op::v1::Subtract>(parent))
+        parent = parent->get_input_node_ptr(0);
+    return is_compressed_weights(parent);
+}
 // Subtract as ZeroPoints for Convolution
 bool isSuitableSubtractAsZeroPointsParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v1::Subtract>(node);
@@ -458,6 +503,9 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (isSuitableSubtractAsZeroPointsParent(node)) {
             SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
             channelAxis = DEFAULT_AXIS;
+        } else if (isMatMulWeightsDecompressionNode(node)) {
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            channelAxis = DEFAULT_AXIS;
         } else {
             for (const auto fusingChainType : getContinuableChains(node)) {
                 if (fusingChainType == NodeFusingType::FusedWithReduce) {
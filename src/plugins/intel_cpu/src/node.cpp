@@ -792,15 +792,18 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
         IE_THROW() << "Can't prepare memory for internal blob, internal blob and internal descs number do not match "
                    << internalBlobs.size() << " vs " << intDescs.size();
     }
+    if (internalBlobs.size() != internalBlobPorts.size()) {
+        IE_THROW() << "Can't prepare memory for internal blob, the constant inputs of internal blobs are not set for node "
+                   << getName();
+    }
 
     internalBlobMemory.clear();
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
+        // TODO [DS]: internal blobs should be removed or rewritten using Memory object
+        auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
         auto create = [&] () {
-            // TODO [DS]: internal blobs should be removed or rewritten using Memory object
-            auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
-
             Memory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
@@ -811,20 +814,14 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
             return _ptr;
         };
 
-        MemoryPtr ptr;
-        auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = name + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
-            ptr = *weightCache->findOrCreate(string_hash, create);
-        } else {
-            ptr = create();
-        }
+        // the other streams and compiled models of the same model share the repacked weights. The internal blob
+        // is released by cleanup(), so the source is the constant the blob is made of, which lives with the graph
+        const auto key = WeightsSharing::packedWeightsKey(newDesc->getDnnlDesc(), internalBlob->buffer(),
+                                                          internalBlob->byteSize(), intDescs[i]->getDnnlDesc());
+        const auto& constMemory = getParentEdgesAtPort(internalBlobPorts[i])[0]->getMemoryPtr();
+        const std::shared_ptr<const void> source(constMemory, constMemory->GetData());
+        MemoryPtr ptr = *context->getPackedWeightsCache()->findOrCreatePacked(key, create, source,
+                                                                              constMemory->GetSize());
 
         internalBlobMemory.push_back(ptr);
     }
@@ -918,6 +915,7 @@ void Node::addOriginalLayer(const std::string& layerName) {
 
 void Node::cleanup() {
     internalBlobs.clear();
+    internalBlobPorts.clear();
 
     for (auto it : fusedWith) {
         it->cleanup();
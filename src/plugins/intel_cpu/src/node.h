@@ -503,6 +503,13 @@ public:
         return internalBlobs;
     }
 
+    /**
+     * @brief Returns the memory the node keeps besides the memory of its edges, e.g. the repacked weights
+     */
+    virtual std::vector<MemoryCPtr> getInternalMemory() const {
+        return {internalBlobMemory.begin(), internalBlobMemory.end()};
+    }
+
     /**
     * @brief Return scales and shift if nodes can be executed as ScaleShift, else raise exception
     * If node has only scale or shift value, fill missing value with default values
@@ -574,6 +581,8 @@ protected:
     InPlaceType inplace = InPlaceType::Unknown;
     ConstantType constant = ConstantType::Unknown;
     std::vector<InferenceEngine::Blob::Ptr> internalBlobs;
+    // the constant input ports the internal blobs are made of
+    std::vector<size_t> internalBlobPorts;
     std::vector<MemoryPtr> internalBlobMemory;
     std::vector<NodeDesc> supportedPrimitiveDescriptors;
     std::unordered_map<int, dnnl::memory> primArgs;
@@ -11,6 +11,7 @@
 #include <openvino/core/type.hpp>
 #include <ie/ie_parallel.hpp>
 #include <utils/jit_kernel.hpp>
+#include "eltwise.h"
 
 using namespace InferenceEngine;
 using namespace dnnl::impl::utils;
@@ -44,6 +45,11 @@ public:
 
     template <typename T>
     std::tuple<T, T, T> yuv_to_rgb(float y, float u, float v);
+
+protected:
+    // Fused per channel mean/scale in r,g,b order: { scale_r, scale_g, scale_b, shift_r, shift_g, shift_b }
+    std::array<float, 6> _postOps {{ 1.f, 1.f, 1.f, 0.f, 0.f, 0.f }};
+    bool _withPostOps = false;
 };
 
 Converter::Converter(Node *node)
@@ -51,6 +57,28 @@ Converter::Converter(Node *node)
                     || node->getAlgorithm() == Algorithm::ColorConvertI420toRGB
                         ? ColorFormat { { 0, 1, 2 } }
                         : ColorFormat { { 2, 1, 0 } }) {
+    // The fused nodes are applied one after another, so they are folded into a single scale and shift per channel
+    std::array<float, 3> scales {{ 1.f, 1.f, 1.f }};
+    std::array<float, 3> shifts {{ 0.f, 0.f, 0.f }};
+    for (const auto & fusedNode : node->getFusedWith()) {
+        const auto eltwise = std::dynamic_pointer_cast<Eltwise>(fusedNode);
+        if (!eltwise)
+            IE_THROW() << "Color convert node " << node->getName() << " has unexpected fused node " << fusedNode->getName();
+        const auto & fusedScales = eltwise->getScales();
+        const auto & fusedShifts = eltwise->getShifts();
+        for (size_t c = 0; c < scales.size(); c++) {
+            const float scale = fusedScales.empty() ? 1.f : fusedScales[fusedScales.size() == 1 ? 0 : c];
+            const float shift = fusedShifts.empty() ? 0.f : fusedShifts[fusedShifts.size() == 1 ? 0 : c];
+            scales[c] *= scale;
+            shifts[c] = shifts[c] * scale + shift;
+        }
+        _withPostOps = true;
+    }
+    // the values are indexed by the output channel, while the kernels produce r, g and b
+    for (size_t i = 0; i < scales.size(); i++) {
+        _postOps[i] = scales[_colorFormat[i]];
+        _postOps[scales.size() + i] = shifts[_colorFormat[i]];
+    }
 }
 
 bool Converter::singlePlane() const {
@@ -85,6 +113,7 @@ struct jit_uni_converter : public jit_kernel {
         void * dst;
         size_t width;
         uint8_t colorFormat;    // RGB: 0, BGR: !=0
+        const float * postOps;  // fused scales and shifts, see Converter::_postOps
     };
 
     typedef void (*function_t)(const Params *);
@@ -96,7 +125,7 @@ struct jit_uni_converter : public jit_kernel {
     }
 
 protected:
-    jit_uni_converter();
+    jit_uni_converter(bool withPostOps);
 
     template<size_t N>
     void yuv_to_rgb(const variable<float[N]> & y,
@@ -113,11 +142,15 @@ protected:
 
     function_t _fn;
     variable<const float*> _consts;
+    variable<const float*> _postOps;
+    bool _withPostOps;
 };
 
-jit_uni_converter::jit_uni_converter()
+jit_uni_converter::jit_uni_converter(bool withPostOps)
     : jit_kernel(jit_name()),
-      _consts(*this) {
+      _consts(*this),
+      _postOps(*this),
+      _withPostOps(withPostOps) {
 }
 
 void jit_uni_converter::init() {
@@ -238,6 +271,20 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
     clip(g, y, u);
     clip(b, y, u);
 
+    if (_withPostOps) {
+        // fused mean/scale: op = op * scale + shift
+        auto post_op = [&](const variable<float[N]> & op, size_t channel) {
+            uni_vbroadcastss(tmp, ptr[_postOps + channel * sizeof(float)]);
+            uni_vmulps(op, op, tmp);
+            uni_vbroadcastss(tmp, ptr[_postOps + (3 + channel) * sizeof(float)]);
+            uni_vaddps(op, op, tmp);
+        };
+
+        post_op(r, 0);
+        post_op(g, 1);
+        post_op(b, 2);
+    }
+
     _if(color_format == 0)
     ._then([&]{ blend(r, g, b, y, u, v); })
     ._else([&]{ blend(b, g, r, y, u, v); });
@@ -272,11 +319,15 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // U8 input is converted to FP32 output when the preceding Convert is merged into the node
+    const Precision outPrecision = precision == Precision::U8 && node->getOriginalOutputPrecisionAtPort(0) == Precision::U8
+                                    ? Precision::U8
+                                    : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -285,9 +336,9 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     return descs;
 }
 
-template<typename T, impl_desc_type I>
+template<typename T, impl_desc_type I, typename TOut = T>
 class SinglePlaneConvert;
-template<typename T, impl_desc_type I>
+template<typename T, impl_desc_type I, typename TOut = T>
 class TwoPlaneConvert;
 
 class RefConverter : public Converter {
@@ -295,10 +346,10 @@ public:
     RefConverter(Node *node);
 
 protected:
-    template<typename T>
+    template<typename T, typename TOut>
     void convert(const T* y,
                  const T* uv,
-                 T* dst,
+                 TOut* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -314,17 +365,17 @@ RefConverter::RefConverter(Node *node)
         IE_THROW() <<"NV12Converter node has incorrect number of outputs";
 }
 
-template<typename T>
+template<typename T, typename TOut>
 void RefConverter::convert(const T* y,
                            const T* uv,
-                           T* dst,
+                           TOut* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
     InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TOut* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto uv_ptr = uv + batch * stride_uv;
 
@@ -334,8 +385,13 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * width + (w / 2) * 2;
             auto u_val = static_cast<float>(uv_ptr[uv_index]);
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
-            T r, g, b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            TOut r, g, b;
+            std::tie(r, g, b) = yuv_to_rgb<TOut>(y_val, u_val, v_val);
+            if (_withPostOps) {
+                r = static_cast<TOut>(r * _postOps[0] + _postOps[3]);
+                g = static_cast<TOut>(g * _postOps[1] + _postOps[4]);
+                b = static_cast<TOut>(b * _postOps[2] + _postOps[5]);
+            }
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -343,8 +399,8 @@ void RefConverter::convert(const T* y,
     });
 }
 
-template<typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template<typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -357,9 +413,9 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
-        convert<T>(y, uv, dst,
+        convert<T, TOut>(y, uv, dst,
                    batch_size,
                    height,
                    width,
@@ -368,8 +424,8 @@ public:
     }
 };
 
-template<typename T>
-class TwoPlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template<typename T, typename TOut>
+class TwoPlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -378,13 +434,13 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, uv, dst,
+        convert<T, TOut>(y, uv, dst,
                    batch_size,
                    height,
                    width,
@@ -393,11 +449,16 @@ public:
     }
 };
 
-template<typename T>
+template<typename T, typename TOut = T>
 class JitConverter;
 
-template<typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template<typename T, size_t N, typename TOut>
+class JitConverter<T[N], TOut> : public jit_uni_converter {
+public:
+    JitConverter(bool withPostOps)
+        : jit_uni_converter(withPostOps) {
+    }
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -410,22 +471,25 @@ private:
     unpack_uv(const variable<float[N]> & uv);
 };
 
-template<typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template<typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_uv = arg<const T*>(&Params::u);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TOut*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
     static const float data[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
     _consts = data;
 
+    if (_withPostOps)
+        mov(_postOps, argPtr(&Params::postOps));
+
     const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TOut);
 
     width >>= reg_capacity_log;
 
@@ -437,7 +501,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<1>(yuv);
         const auto & v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TOut>::value);
 
         store(dst, y);  dst += step;
         store(dst, u);  dst += step;
@@ -461,7 +525,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<0>(uv_pair);
         const auto & v = std::get<1>(uv_pair);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TOut>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -469,11 +533,11 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template<typename T, size_t N>
+template<typename T, size_t N, typename TOut>
 std::tuple<jit_kernel::variable<float[N]>,
            jit_kernel::variable<float[N]>,
            jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T *> & src_y,
+JitConverter<T[N], TOut>::load_yuv(const variable<const T *> & src_y,
                              const variable<const T *> & src_uv) {
     auto y = var<float[N]>();
     auto uv = var<float[N]>();
@@ -491,10 +555,10 @@ JitConverter<T[N]>::load_yuv(const variable<const T *> & src_y,
                            std::move(std::get<1>(uv_pair)));
 }
 
-template<typename T, size_t N>
+template<typename T, size_t N, typename TOut>
 std::tuple<jit_kernel::variable<float[N]>,
            jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::unpack_uv(const variable<float[N]> & uv) {
+JitConverter<T[N], TOut>::unpack_uv(const variable<float[N]> & uv) {
     auto u = var<float[N]>();
     auto v = var<float[N]>();
 
@@ -507,21 +571,21 @@ JitConverter<T[N]>::unpack_uv(const variable<float[N]> & uv) {
     return std::make_tuple(std::move(u), std::move(v));
 }
 
-template<typename T>
-const jit_uni_converter & jit_converter_create() {
-    auto createKernel = []() {
+template<typename T, typename TOut>
+const jit_uni_converter & jit_converter_create(bool withPostOps) {
+    auto createKernel = [](bool withPostOps) {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else {
@@ -531,26 +595,31 @@ const jit_uni_converter & jit_converter_create() {
         return kernel;
     };
 
-    static auto kernel = createKernel();
+    if (withPostOps) {
+        static auto kernel = createKernel(true);
+        return *kernel;
+    }
+
+    static auto kernel = createKernel(false);
 
     return *kernel;
 }
 
-template<typename T>
-const jit_uni_converter & jit_converter_get() {
-    return jit_converter_create<T>();
+template<typename T, typename TOut>
+const jit_uni_converter & jit_converter_get(bool withPostOps) {
+    return jit_converter_create<T, TOut>(withPostOps);
 }
 
-template<typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template<typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     SinglePlaneConvert(Node *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>(_withPostOps);
     }
 
     void execute(dnnl::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T, TOut>(_withPostOps);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -559,7 +628,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -571,21 +640,22 @@ public:
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.postOps = _postOps.data();
             kernel(args);
         });
     }
 };
 
-template<typename T>
-class TwoPlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template<typename T, typename TOut>
+class TwoPlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     TwoPlaneConvert(Node *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>(_withPostOps);
     }
 
     void execute(dnnl::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T, TOut>(_withPostOps);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -594,7 +664,7 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
@@ -606,6 +676,7 @@ public:
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.postOps = _postOps.data();
             kernel(args);
         });
     }
@@ -621,11 +692,15 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // U8 input is converted to FP32 output when the preceding Convert is merged into the node
+    const Precision outPrecision = precision == Precision::U8 && node->getOriginalOutputPrecisionAtPort(0) == Precision::U8
+                                    ? Precision::U8
+                                    : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -634,9 +709,9 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     return descs;
 }
 
-template<typename T, impl_desc_type I>
+template<typename T, impl_desc_type I, typename TOut = T>
 class SinglePlaneConvert;
-template<typename T, impl_desc_type I>
+template<typename T, impl_desc_type I, typename TOut = T>
 class ThreePlaneConvert;
 
 class RefConverter : public Converter {
@@ -644,11 +719,11 @@ public:
     RefConverter(Node *node);
 
 protected:
-    template<typename T>
+    template<typename T, typename TOut>
     void convert(const T* y,
                  const T* u,
                  const T* v,
-                 T* dst,
+                 TOut* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -664,18 +739,18 @@ RefConverter::RefConverter(Node *node)
         IE_THROW() <<"I420Converter node has incorrect number of outputs";
 }
 
-template<typename T>
+template<typename T, typename TOut>
 void RefConverter::convert(const T* y,
                            const T* u,
                            const T* v,
-                           T* dst,
+                           TOut* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
     InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
+        TOut* out = dst + batch * width * height * 3;
         auto y_ptr = y + batch * stride_y;
         auto u_ptr = u + batch * stride_uv;
         auto v_ptr = v + batch * stride_uv;
@@ -686,8 +761,13 @@ void RefConverter::convert(const T* y,
             auto uv_index = (h / 2) * (width / 2) + w / 2;
             auto u_val = static_cast<float>(u_ptr[uv_index]);
             auto v_val = static_cast<float>(v_ptr[uv_index]);
-            T r, g, b;
-            std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
+            TOut r, g, b;
+            std::tie(r, g, b) = yuv_to_rgb<TOut>(y_val, u_val, v_val);
+            if (_withPostOps) {
+                r = static_cast<TOut>(r * _postOps[0] + _postOps[3]);
+                g = static_cast<TOut>(g * _postOps[1] + _postOps[4]);
+                b = static_cast<TOut>(b * _postOps[2] + _postOps[5]);
+            }
             out[y_index * 3 + _colorFormat[0]] = r;
             out[y_index * 3 + _colorFormat[1]] = g;
             out[y_index * 3 + _colorFormat[2]] = b;
@@ -695,8 +775,8 @@ void RefConverter::convert(const T* y,
     });
 }
 
-template<typename T>
-class SinglePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template<typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -710,9 +790,9 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
-        convert<T>(y, u, v, dst,
+        convert<T, TOut>(y, u, v, dst,
                    batch_size,
                    height,
                    width,
@@ -721,8 +801,8 @@ public:
     }
 };
 
-template<typename T>
-class ThreePlaneConvert<T, impl_desc_type::ref> : public RefConverter {
+template<typename T, typename TOut>
+class ThreePlaneConvert<T, impl_desc_type::ref, TOut> : public RefConverter {
 public:
     using RefConverter::RefConverter;
 
@@ -732,13 +812,13 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, u, v, dst,
+        convert<T, TOut>(y, u, v, dst,
                    batch_size,
                    height,
                    width,
@@ -747,11 +827,16 @@ public:
     }
 };
 
-template<typename T>
+template<typename T, typename TOut = T>
 class JitConverter;
 
-template<typename T, size_t N>
-class JitConverter<T[N]> : public jit_uni_converter {
+template<typename T, size_t N, typename TOut>
+class JitConverter<T[N], TOut> : public jit_uni_converter {
+public:
+    JitConverter(bool withPostOps)
+        : jit_uni_converter(withPostOps) {
+    }
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -764,23 +849,26 @@ private:
                    const variable<float[N]> & v);
 };
 
-template<typename T, size_t N>
-void JitConverter<T[N]>::generate() {
+template<typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::generate() {
     preamble();
 
     // Get arguments addresses
     auto src_y = arg<const T*>(&Params::y);
     auto src_u = arg<const T*>(&Params::u);
     auto src_v = arg<const T*>(&Params::v);
-    auto dst = arg<T*>(&Params::dst);
+    auto dst = arg<TOut*>(&Params::dst);
     auto width = arg(&Params::width);
     auto colorFormat = arg(&Params::colorFormat);
 
     static const float data[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
     _consts = data;
 
+    if (_withPostOps)
+        mov(_postOps, argPtr(&Params::postOps));
+
     const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
-    const size_t step = N * sizeof(T);
+    const size_t step = N * sizeof(TOut);
 
     width >>= reg_capacity_log;
 
@@ -792,7 +880,7 @@ void JitConverter<T[N]>::generate() {
         const auto & u = std::get<1>(yuv);
         const auto & v = std::get<2>(yuv);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TOut>::value);
 
         store(dst, y);  dst += step;
         store(dst, u);  dst += step;
@@ -816,7 +904,7 @@ void JitConverter<T[N]>::generate() {
 
         unpack_uv(u, v);
 
-        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<T>::value);
+        yuv_to_rgb(y, u, v, colorFormat, std::is_integral<TOut>::value);
 
         store_tail(dst, y, u, v, width);
     });
@@ -824,11 +912,11 @@ void JitConverter<T[N]>::generate() {
     postamble();
 }
 
-template<typename T, size_t N>
+template<typename T, size_t N, typename TOut>
 std::tuple<jit_kernel::variable<float[N]>,
            jit_kernel::variable<float[N]>,
            jit_kernel::variable<float[N]>>
-JitConverter<T[N]>::load_yuv(const variable<const T *> & src_y,
+JitConverter<T[N], TOut>::load_yuv(const variable<const T *> & src_y,
                              const variable<const T *> & src_u,
                              const variable<const T *> & src_v) {
     auto y = var<float[N]>();
@@ -848,29 +936,29 @@ JitConverter<T[N]>::load_yuv(const variable<const T *> & src_y,
     return std::make_tuple(std::move(y), std::move(u), std::move(v));
 }
 
-template<typename T, size_t N>
-void JitConverter<T[N]>::unpack_uv(const variable<float[N]> & u,
+template<typename T, size_t N, typename TOut>
+void JitConverter<T[N], TOut>::unpack_uv(const variable<float[N]> & u,
                                    const variable<float[N]> & v) {
     static const uint8_t order[] = { 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 };
     u.permute(order);
     v.permute(order);
 }
 
-template<typename T>
-const jit_uni_converter & jit_converter_create() {
-    auto createKernel = []() {
+template<typename T, typename TOut>
+const jit_uni_converter & jit_converter_create(bool withPostOps) {
+    auto createKernel = [](bool withPostOps) {
         std::unique_ptr<jit_uni_converter> kernel;
 
         if (mayiuse(cpu_isa_t::avx512_core)) {
-            auto converter = new JitConverter<T[16]>;
+            auto converter = new JitConverter<T[16], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::avx2)) {
-            auto converter = new JitConverter<T[8]>;
+            auto converter = new JitConverter<T[8], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else if (mayiuse(cpu_isa_t::sse41)) {
-            auto converter = new JitConverter<T[4]>;
+            auto converter = new JitConverter<T[4], TOut>(withPostOps);
             kernel.reset(converter);
             converter->init();
         } else {
@@ -880,26 +968,31 @@ const jit_uni_converter & jit_converter_create() {
         return kernel;
     };
 
-    static auto kernel = createKernel();
+    if (withPostOps) {
+        static auto kernel = createKernel(true);
+        return *kernel;
+    }
+
+    static auto kernel = createKernel(false);
 
     return *kernel;
 }
 
-template<typename T>
-const jit_uni_converter & jit_converter_get() {
-    return jit_converter_create<T>();
+template<typename T, typename TOut>
+const jit_uni_converter & jit_converter_get(bool withPostOps) {
+    return jit_converter_create<T, TOut>(withPostOps);
 }
 
-template<typename T>
-class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template<typename T, typename TOut>
+class SinglePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     SinglePlaneConvert(Node *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>(_withPostOps);
     }
 
     void execute(dnnl::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T, TOut>(_withPostOps);
         const auto & dims = inputDims(0);
 
         const size_t batch_size = dims[N_DIM];
@@ -909,7 +1002,7 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
@@ -922,27 +1015,28 @@ public:
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.postOps = _postOps.data();
             kernel(args);
         });
     }
 };
 
-template<typename T>
-class ThreePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
+template<typename T, typename TOut>
+class ThreePlaneConvert<T, impl_desc_type::jit_uni, TOut> : public Converter {
 public:
     ThreePlaneConvert(Node *node)
         : Converter(node) {
-        jit_converter_create<T>();
+        jit_converter_create<T, TOut>(_withPostOps);
     }
 
     void execute(dnnl::stream strm) override {
-        const auto & kernel = jit_converter_get<T>();
+        const auto & kernel = jit_converter_get<T, TOut>(_withPostOps);
         const auto & dims = inputDims(0);
 
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
+        TOut* dst = static_cast<TOut*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
@@ -959,6 +1053,7 @@ public:
             args.dst = dst + (batch * width * height + h * width) * 3;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+            args.postOps = _postOps.data();
             kernel(args);
         });
     }
@@ -1082,9 +1177,11 @@ void ColorConvert::initSupportedPrimitiveDescriptors() {
 }
 
 void ColorConvert::initSupportedNV12Impls() {
-    #define SUPPORTED_IMPL(Impl, type, desc_type)                           \
-        [](Node *node) {                                              \
-            return new nv12::Impl<type, impl_desc_type::desc_type>(node);   \
+    #define SUPPORTED_IMPL(Impl, type, desc_type)                                       \
+        [](Node *node) -> Converter * {                                             \
+            if (node->getOriginalOutputPrecisionAtPort(0) != Precision::U8)         \
+                return new nv12::Impl<type, impl_desc_type::desc_type, float>(node);  \
+            return new nv12::Impl<type, impl_desc_type::desc_type>(node);             \
         };
 
     // ref
@@ -1109,9 +1206,11 @@ void ColorConvert::initSupportedNV12Impls() {
 }
 
 void ColorConvert::initSupportedI420Impls() {
-    #define SUPPORTED_IMPL(Impl, type, desc_type)                           \
-        [](Node *node) {                                              \
-            return new i420::Impl<type, impl_desc_type::desc_type>(node);   \
+    #define SUPPORTED_IMPL(Impl, type, desc_type)                                       \
+        [](Node *node) -> Converter * {                                             \
+            if (node->getOriginalOutputPrecisionAtPort(0) != Precision::U8)         \
+                return new i420::Impl<type, impl_desc_type::desc_type, float>(node);  \
+            return new i420::Impl<type, impl_desc_type::desc_type>(node);             \
         };
 
     // ref
@@ -1173,6 +1272,21 @@ void ColorConvert::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+bool ColorConvert::canFuse(const NodePtr& node) const {
+    // Only the per channel mean/scale of the FP32 output can be applied by the converters
+    if (getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        node->getType() != Type::Eltwise ||
+        node->getAlgorithm() == Algorithm::EltwisePrelu ||
+        node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32) {
+        return false;
+    }
+    return node->canBePerformedAsScaleShift(this);
+}
+
+int ColorConvert::getFusingAxis() const {
+    return Converter::C_DIM;
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -27,6 +27,8 @@ public:
     bool created() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    bool canFuse(const NodePtr& node) const override;
+    int getFusingAxis() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
@@ -0,0 +1,287 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+// Matrix multiplication by the compressed weights: dst[M, N] = src[M, K] * W^T + bias, where W[N, K] is stored
+// as i8/u8 values with the scale and the optional zero point per group of groupSize consecutive elements of the row:
+//     W[n, k] = (w[n, k] - zeroPoint[n, k / groupSize]) * scale[n, k / groupSize]
+// The weights are never unpacked completely:
+//  - for the small M (the token generation of LLMs, the memory bound case) the scale and the zero point are taken
+//    out of the dot product, since they are common for the group:
+//        sum_k(x[k] * W[n, k]) = sum_g(scale[n, g] * (sum_k(x[k] * w[n, k]) - zeroPoint[n, g] * sum_k(x[k])))
+//    where the sums of the source over the groups are calculated once. The inner loop only converts
+//    the compressed values and accumulates them, so the weights are read once and in the compressed form;
+//  - for the large M every thread dequantizes the small tile of the weights, which stays in L1 cache,
+//    and multiplies all rows of the source by it, so the cost of the dequantization is shared by the rows.
+// FullyConnected runs the kernel for M below dequantizing_gemm::largeM only, the larger M are multiplied by oneDNN
+// with the weights decompressed once by decompressWeights.
+
+struct DecompressionWeights {
+    const void* data;           // [N, K]
+    bool isSigned;              // i8 or u8
+    const float* scales;        // [N, K / groupSize]
+    const float* zeroPoints;    // [N, K / groupSize], nullptr if there are no zero points
+    size_t groupSize;
+};
+
+namespace dequantizing_gemm {
+
+constexpr size_t blockM = 4;
+constexpr size_t lanes = 32;
+// the tiled path is used starting from largeM rows of the source
+constexpr size_t tileN = 16;
+constexpr size_t tileK = 256;
+constexpr size_t largeM = 16;
+
+// Dot products of the rows of the source with the part [kBegin, kEnd) of the compressed weights row,
+// the independent accumulators of the lanes are vectorized by the compiler.
+template <size_t rows, typename Twei, typename Tsrc>
+inline void dotRows(const Tsrc* src, size_t K, const Twei* w, size_t kBegin, size_t kEnd, float* out) {
+    float sum[rows][lanes] = {};
+    size_t k = kBegin;
+    for (; k + lanes <= kEnd; k += lanes) {
+        float wv[lanes];
+        for (size_t l = 0; l < lanes; l++)
+            wv[l] = static_cast<float>(w[k + l]);
+        for (size_t i = 0; i < rows; i++)
+            for (size_t l = 0; l < lanes; l++)
+                sum[i][l] += static_cast<float>(src[i * K + k + l]) * wv[l];
+    }
+    for (size_t i = 0; i < rows; i++) {
+        float result = 0.f;
+        for (size_t l = 0; l < lanes; l++)
+            result += sum[i][l];
+        for (size_t r = k; r < kEnd; r++)
+            result += static_cast<float>(src[i * K + r]) * static_cast<float>(w[r]);
+        out[i] = result;
+    }
+}
+
+template <size_t rows, typename Twei, typename Tsrc>
+inline void rowsByWeightsRow(const Tsrc* src, size_t K, const Twei* w, const float* scales, const float* zeroPoints,
+                             const float* srcSums, size_t groupsNum, size_t groupSize, float* out) {
+    float result[rows] = {};
+    float dot[rows];
+    for (size_t g = 0; g < groupsNum; g++) {
+        dotRows<rows>(src, K, w, g * groupSize, (g + 1) * groupSize, dot);
+        for (size_t i = 0; i < rows; i++) {
+            const float zeroPointTerm = zeroPoints ? zeroPoints[g] * srcSums[i * groupsNum + g] : 0.f;
+            result[i] += scales[g] * (dot[i] - zeroPointTerm);
+        }
+    }
+    for (size_t i = 0; i < rows; i++)
+        out[i] = result[i];
+}
+
+// Dequantizes the tile of the weights into the buffer transposed to [kCount, tileN],
+// the rows out of the matrix are filled by zeros.
+template <typename Twei>
+void dequantizeTile(const Twei* weights, const DecompressionWeights& wei, size_t K, size_t n0, size_t nCount,
+                    size_t k0, size_t kCount, float* buf) {
+    const size_t groupsNum = K / wei.groupSize;
+    for (size_t j = 0; j < tileN; j++) {
+        if (j >= nCount) {
+            for (size_t k = 0; k < kCount; k++)
+                buf[k * tileN + j] = 0.f;
+            continue;
+        }
+        const size_t row = n0 + j;
+        const Twei* w = weights + row * K;
+        size_t k = k0;
+        while (k < k0 + kCount) {
+            const size_t group = k / wei.groupSize;
+            const size_t groupEnd = std::min((group + 1) * wei.groupSize, k0 + kCount);
+            const float scale = wei.scales[row * groupsNum + group];
+            const float zeroPoint = wei.zeroPoints ? wei.zeroPoints[row * groupsNum + group] : 0.f;
+            for (; k < groupEnd; k++)
+                buf[(k - k0) * tileN + j] = (static_cast<float>(w[k]) - zeroPoint) * scale;
+        }
+    }
+}
+
+// Accumulates rows x tileN block of the result by the dequantized tile, the source rows are packed with the stride kCount.
+template <size_t rows>
+inline void multiplyTile(const float* src, const float* buf, size_t kCount, float* acc) {
+    float sum[rows][tileN];
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < tileN; j++)
+            sum[i][j] = acc[i * tileN + j];
+
+    // The row pointers keep the compiler from the vectorization over k, which is slow for the runtime kCount.
+    const float* rowPtr[rows];
+    for (size_t i = 0; i < rows; i++)
+        rowPtr[i] = src + i * kCount;
+    for (size_t k = 0; k < kCount; k++) {
+        const float* w = buf + k * tileN;
+        for (size_t i = 0; i < rows; i++) {
+            const float x = rowPtr[i][k];
+            for (size_t j = 0; j < tileN; j++)
+                sum[i][j] += x * w[j];
+        }
+    }
+
+    for (size_t i = 0; i < rows; i++)
+        for (size_t j = 0; j < tileN; j++)
+            acc[i * tileN + j] = sum[i][j];
+}
+
+template <typename Twei, typename Tsrc, typename Tdst>
+void gemmTiled(const Tsrc* src, Tdst* dst, const float* bias, size_t M, size_t N, size_t K,
+               const DecompressionWeights& wei, int nthr) {
+    const size_t tilesNum = (N + tileN - 1) / tileN;
+    const auto weights = static_cast<const Twei*>(wei.data);
+    nthr = static_cast<int>(std::max<size_t>(1, std::min<size_t>(nthr, tilesNum)));
+
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(tilesNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        std::vector<float> buf(tileK * tileN);
+        std::vector<float> acc(M * tileN);
+        // The source block is packed, otherwise the rows with the large power of two stride evict each other from the cache.
+        std::vector<float> srcBuf(M * tileK);
+        for (size_t t = start; t < end; t++) {
+            const size_t n0 = t * tileN;
+            const size_t nCount = std::min(tileN, N - n0);
+            std::fill(acc.begin(), acc.end(), 0.f);
+
+            for (size_t k0 = 0; k0 < K; k0 += tileK) {
+                const size_t kCount = std::min(tileK, K - k0);
+                dequantizeTile(weights, wei, K, n0, nCount, k0, kCount, buf.data());
+                for (size_t m = 0; m < M; m++) {
+                    for (size_t k = 0; k < kCount; k++)
+                        srcBuf[m * kCount + k] = static_cast<float>(src[m * K + k0 + k]);
+                }
+
+                size_t m = 0;
+                for (; m + blockM <= M; m += blockM)
+                    multiplyTile<blockM>(srcBuf.data() + m * kCount, buf.data(), kCount, acc.data() + m * tileN);
+                for (; m < M; m++)
+                    multiplyTile<1>(srcBuf.data() + m * kCount, buf.data(), kCount, acc.data() + m * tileN);
+            }
+
+            for (size_t m = 0; m < M; m++) {
+                for (size_t j = 0; j < nCount; j++)
+                    dst[m * N + n0 + j] = static_cast<Tdst>(acc[m * tileN + j] + (bias ? bias[n0 + j] : 0.f));
+            }
+        }
+    });
+}
+
+template <typename Twei, typename Tsrc, typename Tdst>
+void gemm(const Tsrc* src, Tdst* dst, const float* bias, size_t M, size_t N, size_t K,
+          const DecompressionWeights& wei, int nthr) {
+    if (nthr <= 0)
+        nthr = parallel_get_max_threads();
+    if (M >= largeM) {
+        gemmTiled<Twei>(src, dst, bias, M, N, K, wei, nthr);
+        return;
+    }
+
+    const size_t groupsNum = K / wei.groupSize;
+    const auto weights = static_cast<const Twei*>(wei.data);
+
+    // Sums of the source rows over the groups for the zero points.
+    std::vector<float> srcSums;
+    if (wei.zeroPoints) {
+        srcSums.resize(M * groupsNum);
+        InferenceEngine::parallel_for(M, [&](size_t m) {
+            for (size_t g = 0; g < groupsNum; g++) {
+                float sum = 0.f;
+                for (size_t k = g * wei.groupSize; k < (g + 1) * wei.groupSize; k++)
+                    sum += static_cast<float>(src[m * K + k]);
+                srcSums[m * groupsNum + g] = sum;
+            }
+        });
+    }
+
+    nthr = static_cast<int>(std::max<size_t>(1, std::min<size_t>(nthr, N)));
+
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(N, nthr, ithr, start, end);
+        float out[blockM];
+        for (size_t n = start; n < end; n++) {
+            const Twei* w = weights + n * K;
+            const float* scales = wei.scales + n * groupsNum;
+            const float* zeroPoints = wei.zeroPoints ? wei.zeroPoints + n * groupsNum : nullptr;
+            const float biasValue = bias ? bias[n] : 0.f;
+            // the sums are not calculated without the zero points
+            auto sums = [&](size_t m) {
+                return zeroPoints ? srcSums.data() + m * groupsNum : nullptr;
+            };
+
+            size_t m = 0;
+            for (; m + blockM <= M; m += blockM) {
+                rowsByWeightsRow<blockM>(src + m * K, K, w, scales, zeroPoints, sums(m),
+                                         groupsNum, wei.groupSize, out);
+                for (size_t i = 0; i < blockM; i++)
+                    dst[(m + i) * N + n] = static_cast<Tdst>(out[i] + biasValue);
+            }
+            for (; m < M; m++) {
+                rowsByWeightsRow<1>(src + m * K, K, w, scales, zeroPoints, sums(m),
+                                    groupsNum, wei.groupSize, out);
+                dst[m * N + n] = static_cast<Tdst>(out[0] + biasValue);
+            }
+        }
+    });
+}
+
+template <typename Twei, typename Tdst>
+void decompress(const DecompressionWeights& wei, size_t N, size_t K, Tdst* dst) {
+    const size_t groupsNum = K / wei.groupSize;
+    const auto weights = static_cast<const Twei*>(wei.data);
+    InferenceEngine::parallel_for(N, [&](size_t n) {
+        for (size_t g = 0; g < groupsNum; g++) {
+            const float scale = wei.scales[n * groupsNum + g];
+            const float zeroPoint = wei.zeroPoints ? wei.zeroPoints[n * groupsNum + g] : 0.f;
+            for (size_t k = g * wei.groupSize; k < (g + 1) * wei.groupSize; k++)
+                dst[n * K + k] = static_cast<Tdst>((static_cast<float>(weights[n * K + k]) - zeroPoint) * scale);
+        }
+    });
+}
+
+}   // namespace dequantizing_gemm
+
+/**
+ * @brief Computes dst[M, N] = src[M, K] * W^T + bias with the compressed weights W[N, K].
+ * @param bias  [N] or nullptr
+ * @param nthr  number of threads, 0 means the maximal number of threads
+ */
+template <typename Tsrc, typename Tdst>
+void dequantizingGemm(const Tsrc* src, Tdst* dst, const float* bias, size_t M, size_t N, size_t K,
+                      const DecompressionWeights& wei, int nthr = 0) {
+    if (M == 0 || N == 0)
+        return;
+    if (wei.isSigned)
+        dequantizing_gemm::gemm<int8_t>(src, dst, bias, M, N, K, wei, nthr);
+    else
+        dequantizing_gemm::gemm<uint8_t>(src, dst, bias, M, N, K, wei, nthr);
+}
+
+/**
+ * @brief Decompresses the weights W[N, K] completely into dst.
+ */
+template <typename Tdst>
+void decompressWeights(const DecompressionWeights& wei, size_t N, size_t K, Tdst* dst) {
+    if (wei.isSigned)
+        dequantizing_gemm::decompress<int8_t>(wei, N, K, dst);
+    else
+        dequantizing_gemm::decompress<uint8_t>(wei, N, K, dst);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,320 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+// Parallel search of unique keys based on the partitioned hash tables.
+// The keys are distributed between the partitions by their hash, so every partition can be deduplicated
+// by its own thread without any synchronization. The elements keep the input order inside of the partition,
+// therefore the first occurrence of the key is found without additional sorting.
+// The global unique index is defined by the order of the first occurrence (unsorted mode)
+// or by the number of smaller keys in all partitions (sorted mode).
+//
+// Keys accessor has to provide:
+//     uint64_t hash(size_t i) const;
+//     bool equal(size_t i, size_t j) const;
+//     bool less(size_t i, size_t j) const;   // strict weak ordering, required for the sorted mode only
+
+namespace unique_utils {
+
+inline uint64_t mixHash(uint64_t h) {
+    // splitmix64 finalizer
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9lu;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111eblu;
+    h ^= h >> 31;
+    return h;
+}
+
+template <typename T>
+inline uint64_t valueBits(T val) {
+    return static_cast<uint64_t>(val);
+}
+
+inline uint64_t valueBits(float val) {
+    // -0.0 and 0.0 are the same key
+    if (val == 0.f)
+        val = 0.f;
+    uint32_t bits = 0;
+    std::memcpy(&bits, &val, sizeof(bits));
+    return bits;
+}
+
+template <typename T>
+inline bool valueLess(T a, T b) {
+    // NaN is placed after all other values
+    return a < b || (std::is_floating_point<T>::value && !std::isnan(a) && std::isnan(b));
+}
+
+}   // namespace unique_utils
+
+// Every element of the tensor is a key.
+template <typename T>
+struct FlatUniqueKeys {
+    const T* src;
+
+    uint64_t hash(size_t i) const {
+        return unique_utils::mixHash(unique_utils::valueBits(src[i]));
+    }
+    bool equal(size_t i, size_t j) const {
+        return src[i] == src[j];
+    }
+    bool less(size_t i, size_t j) const {
+        return unique_utils::valueLess(src[i], src[j]);
+    }
+};
+
+// The slice of the tensor along the axis is a key. The slice consists of partsInBl parts of elPerPart elements
+// with the step elPerPart * cmpBlNum, the keys are compared lexicographically part by part.
+template <typename T>
+struct SlicedUniqueKeys {
+    const T* src;
+    size_t cmpBlNum;
+    size_t partsInBl;
+    size_t elPerPart;
+
+    uint64_t hash(size_t b) const {
+        uint64_t h = 0;
+        for (size_t p = 0; p < partsInBl; p++) {
+            const T* part = src + (p * cmpBlNum + b) * elPerPart;
+            for (size_t e = 0; e < elPerPart; e++)
+                h = unique_utils::mixHash(h ^ unique_utils::valueBits(part[e]));
+        }
+        return h;
+    }
+    bool equal(size_t b1, size_t b2) const {
+        for (size_t p = 0; p < partsInBl; p++) {
+            const size_t offset = p * cmpBlNum * elPerPart;
+            if (!std::equal(src + offset + b1 * elPerPart, src + offset + (b1 + 1) * elPerPart, src + offset + b2 * elPerPart))
+                return false;
+        }
+        return true;
+    }
+    bool less(size_t b1, size_t b2) const {
+        for (size_t p = 0; p < partsInBl; p++) {
+            const T* part1 = src + (p * cmpBlNum + b1) * elPerPart;
+            const T* part2 = src + (p * cmpBlNum + b2) * elPerPart;
+            for (size_t e = 0; e < elPerPart; e++) {
+                if (unique_utils::valueLess(part1[e], part2[e]))
+                    return true;
+                if (unique_utils::valueLess(part2[e], part1[e]))
+                    return false;
+            }
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Finds the unique keys among keysNum keys.
+ * @param first       [out] index of the first occurrence of every unique key, at least keysNum elements
+ * @param inToOut     [out] index of the unique key for every input key, keysNum elements
+ * @param occurrences [out] number of occurrences of every unique key, at least keysNum elements
+ * @param nthr        number of threads, 0 means the maximal number of threads
+ * @return number of unique keys
+ */
+template <typename Keys>
+size_t hashUnique(const Keys& keys, size_t keysNum, bool sorted,
+                  int32_t* first, int32_t* inToOut, int32_t* occurrences, int nthr = 0) {
+    if (keysNum == 0)
+        return 0;
+
+    // Small inputs do not pay back the threads synchronization.
+    const size_t minKeysPerThread = 4096;
+    if (nthr <= 0)
+        nthr = parallel_get_max_threads();
+    nthr = static_cast<int>(std::max<size_t>(1, std::min<size_t>(nthr, keysNum / minKeysPerThread)));
+    const size_t partsNum = nthr;
+
+    std::vector<uint64_t> hashes(keysNum);
+    auto partitionOf = [partsNum](uint64_t h) {
+        return partsNum == 1 ? 0 : static_cast<size_t>((h >> 32) % partsNum);
+    };
+
+    // 1. Histogram of the partitions per thread.
+    std::vector<size_t> offsets(nthr * partsNum, 0);
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(keysNum, nthr, ithr, start, end);
+        size_t* counts = offsets.data() + ithr * partsNum;
+        for (size_t i = start; i < end; i++) {
+            hashes[i] = keys.hash(i);
+            counts[partitionOf(hashes[i])]++;
+        }
+    });
+
+    // 2. Partition offsets. The chunks of the threads follow each other inside of the partition,
+    //    so the keys of the partition are in the input order.
+    std::vector<size_t> partStart(partsNum + 1, 0);
+    size_t offset = 0;
+    for (size_t q = 0; q < partsNum; q++) {
+        partStart[q] = offset;
+        for (int t = 0; t < nthr; t++) {
+            const size_t count = offsets[t * partsNum + q];
+            offsets[t * partsNum + q] = offset;
+            offset += count;
+        }
+    }
+    partStart[partsNum] = offset;
+
+    // 3. Scatter of the keys into the partitions.
+    std::vector<int32_t> order(keysNum);
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(keysNum, nthr, ithr, start, end);
+        size_t* pos = offsets.data() + ithr * partsNum;
+        for (size_t i = start; i < end; i++)
+            order[pos[partitionOf(hashes[i])]++] = static_cast<int32_t>(i);
+    });
+
+    // 4. Deduplication of every partition by the open addressing hash table.
+    struct Partition {
+        std::vector<int32_t> first;
+        std::vector<int32_t> count;
+        std::vector<int32_t> globalIdx;
+    };
+    std::vector<Partition> parts(partsNum);
+    std::vector<int32_t> localIdx(keysNum);
+    // Total order of the unique keys: the equivalent keys (e.g. NaN) are ordered by the first occurrence.
+    auto uniqueLess = [&keys](int32_t a, int32_t b) {
+        return keys.less(a, b) || (!keys.less(b, a) && a < b);
+    };
+
+    InferenceEngine::parallel_for(partsNum, [&](size_t q) {
+        auto& part = parts[q];
+        const size_t start = partStart[q], end = partStart[q + 1];
+        size_t tableSize = 16;
+        while (tableSize < 2 * (end - start))
+            tableSize <<= 1;
+        const size_t mask = tableSize - 1;
+        std::vector<int32_t> table(tableSize, -1);
+
+        for (size_t k = start; k < end; k++) {
+            const int32_t i = order[k];
+            size_t slot = hashes[i] & mask;
+            int32_t u = table[slot];
+            while (u >= 0 && (hashes[part.first[u]] != hashes[i] || !keys.equal(part.first[u], i))) {
+                slot = (slot + 1) & mask;
+                u = table[slot];
+            }
+            if (u < 0) {
+                u = static_cast<int32_t>(part.first.size());
+                table[slot] = u;
+                part.first.push_back(i);
+                part.count.push_back(0);
+            }
+            part.count[u]++;
+            localIdx[k] = u;
+        }
+
+        if (sorted) {
+            const size_t uniqueNum = part.first.size();
+            std::vector<int32_t> perm(uniqueNum);
+            for (size_t u = 0; u < uniqueNum; u++)
+                perm[u] = static_cast<int32_t>(u);
+            std::sort(perm.begin(), perm.end(), [&](int32_t a, int32_t b) {
+                return uniqueLess(part.first[a], part.first[b]);
+            });
+            std::vector<int32_t> rank(uniqueNum), sortedFirst(uniqueNum), sortedCount(uniqueNum);
+            for (size_t r = 0; r < uniqueNum; r++) {
+                rank[perm[r]] = static_cast<int32_t>(r);
+                sortedFirst[r] = part.first[perm[r]];
+                sortedCount[r] = part.count[perm[r]];
+            }
+            part.first.swap(sortedFirst);
+            part.count.swap(sortedCount);
+            for (size_t k = start; k < end; k++)
+                localIdx[k] = rank[localIdx[k]];
+        }
+        part.globalIdx.resize(part.first.size());
+    });
+
+    // 5. Global indices of the unique keys.
+    size_t uniqueLen = 0;
+    for (const auto& part : parts)
+        uniqueLen += part.first.size();
+
+    if (sorted) {
+        // The global index is the number of smaller unique keys in all partitions,
+        // it is calculated by the merge of the sorted partitions.
+        InferenceEngine::parallel_for(partsNum, [&](size_t q) {
+            auto& part = parts[q];
+            for (size_t u = 0; u < part.first.size(); u++)
+                part.globalIdx[u] = static_cast<int32_t>(u);
+            for (size_t r = 0; r < partsNum; r++) {
+                if (r == q)
+                    continue;
+                const auto& other = parts[r].first;
+                size_t j = 0;
+                for (size_t u = 0; u < part.first.size(); u++) {
+                    while (j < other.size() && uniqueLess(other[j], part.first[u]))
+                        j++;
+                    part.globalIdx[u] += static_cast<int32_t>(j);
+                }
+            }
+        });
+    } else {
+        // The global index is the rank of the first occurrence among the first occurrences of all unique keys.
+        std::vector<uint8_t> isFirst(keysNum, 0);
+        InferenceEngine::parallel_for(partsNum, [&](size_t q) {
+            for (auto i : parts[q].first)
+                isFirst[i] = 1;
+        });
+        std::vector<size_t> threadOffsets(nthr + 1, 0);
+        InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(keysNum, nthr, ithr, start, end);
+            size_t count = 0;
+            for (size_t i = start; i < end; i++)
+                count += isFirst[i];
+            threadOffsets[ithr + 1] = count;
+        });
+        for (int t = 0; t < nthr; t++)
+            threadOffsets[t + 1] += threadOffsets[t];
+        // inToOut is used as a temporary storage of the rank, it is overwritten below.
+        InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            InferenceEngine::splitter(keysNum, nthr, ithr, start, end);
+            int32_t rank = static_cast<int32_t>(threadOffsets[ithr]);
+            for (size_t i = start; i < end; i++) {
+                if (isFirst[i])
+                    inToOut[i] = rank++;
+            }
+        });
+        InferenceEngine::parallel_for(partsNum, [&](size_t q) {
+            auto& part = parts[q];
+            for (size_t u = 0; u < part.first.size(); u++)
+                part.globalIdx[u] = inToOut[part.first[u]];
+        });
+    }
+
+    // 6. Outputs.
+    InferenceEngine::parallel_for(partsNum, [&](size_t q) {
+        const auto& part = parts[q];
+        for (size_t u = 0; u < part.first.size(); u++) {
+            first[part.globalIdx[u]] = part.first[u];
+            occurrences[part.globalIdx[u]] = part.count[u];
+        }
+        for (size_t k = partStart[q]; k < partStart[q + 1]; k++)
+            inToOut[order[k]] = part.globalIdx[localIdx[k]];
+    });
+
+    return uniqueLen;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
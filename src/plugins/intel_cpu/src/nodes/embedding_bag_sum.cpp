@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,13 +11,34 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+// The rows of the indices which are this number of indices ahead are prefetched by the kernel.
+const uint64_t PREFETCH_DISTANCE = 8lu;
+
+inline float tableValue(const uint8_t* row, size_t i, const Precision& prc) {
+    switch (prc) {
+        case Precision::FP32:
+            return reinterpret_cast<const float*>(row)[i];
+        case Precision::BF16:
+            return bfloat16_t::from_bits(reinterpret_cast<const uint16_t*>(row)[i]);
+        case Precision::I8:
+            return reinterpret_cast<const int8_t*>(row)[i];
+        default:
+            return row[i];
+    }
+}
+}   // namespace
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,11 +61,74 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+bool EmbeddingBagSum::isTableDecompressionSupported() {
+    return x64::mayiuse(x64::avx2);
+}
+
+void EmbeddingBagSum::fuseTableDecompression(const std::vector<float>& scales, bool perRowScales) {
+    _withTableDecompression = true;
+    _tableScales = scales;
+    _perRowScales = perRowScales;
+}
+
+Precision EmbeddingBagSum::getOutputPrecision(const Precision& tablePrc) const {
+    if (tablePrc == Precision::BF16 || _withTableDecompression)
+        return Precision::FP32;
+    return tablePrc;
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const Precision& tablePrc) const {
+    if (!isTableDecompressionSupported() || getOutputPrecision(tablePrc) != Precision::FP32)
+        return impl_desc_type::ref_any;
+    return x64::mayiuse(x64::avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void EmbeddingBagSum::prepareParams(const VectorDims& tableStaticShape, const Precision& tablePrc) {
     _embDepth = 1lu;
-    for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
-        _embDepth *= indexStaticShape[i];
+    for (size_t i = 1lu; i < tableStaticShape.size(); i++) {
+        _embDepth *= tableStaticShape[i];
     }
+
+    if (!isTableDecompressionSupported() || getOutputPrecision(tablePrc) != Precision::FP32)
+        return;
+    // the kernels depend only on the row size, so they are not recreated if the number of indices changes
+    if (_jitEmbDepth == _embDepth)
+        return;
+    _jitEmbDepth = _embDepth;
+
+    const size_t dataElPerVec = (x64::mayiuse(x64::avx512_core) ? x64::cpu_isa_traits<x64::avx512_core>::vlen
+                                                                 : x64::cpu_isa_traits<x64::avx2>::vlen) / sizeof(float);
+    _jitWorkAmount = _embDepth - _embDepth % dataElPerVec;
+    _jitKernel.reset();
+    _jitKernelNoWeights.reset();
+    // the row offset is an immediate of the kernel
+    if (_embDepth * tablePrc.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        _jitWorkAmount = 0lu;
+    if (_jitWorkAmount == 0lu)
+        return;
+
+    jEmbeddingBagConfParams jcp;
+    jcp.tablePrc = tablePrc;
+    jcp.rowSize = _embDepth;
+    jcp.workAmount = _jitWorkAmount;
+    jcp.withRowScales = !_tableScales.empty() && _perRowScales;
+    jcp.withScale = !_tableScales.empty() && !_perRowScales;
+    jcp.prefetchDistance = PREFETCH_DISTANCE;
+
+    auto createKernel = [&jcp](bool withWeights) {
+        jcp.withWeights = withWeights;
+        std::shared_ptr<jitEmbeddingBagKernelBase> kernel;
+        if (x64::mayiuse(x64::avx512_core)) {
+            kernel.reset(new jitUniEmbeddingBagKernel<x64::avx512_core>(jcp));
+        } else {
+            kernel.reset(new jitUniEmbeddingBagKernel<x64::avx2>(jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+    _jitKernel = createKernel(_withWeights);
+    if (_withWeights)
+        _jitKernelNoWeights = createKernel(false);
 }
 
 template<typename T>
@@ -119,8 +204,85 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision &srcPrc,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+    const size_t rowSizeB = _embDepth * srcPrc.size();
+    const float* scales = _tableScales.empty() ? nullptr : _tableScales.data();
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                std::fill(dst, dst + _embDepth, 0.f);
+                continue;
+            }
+            withWeights = withWeights & _withWeights;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+            const float* weights = withWeights ? weightsData + weightsIdx : nullptr;
+
+            const auto& kernel = withWeights || !_withWeights ? _jitKernel : _jitKernelNoWeights;
+            if (kernel) {
+                jEmbeddingBagCallArgs args;
+                args.table = srcData;
+                args.indices = indices;
+                args.weights = weights;
+                args.scales = scales;
+                args.dst = dst;
+                args.indicesNum = indicesSize;
+                (*kernel)(&args);
+            }
+
+            // The rest of the row which is shorter than the vector length.
+            for (size_t i = _jitWorkAmount; i < _embDepth; i++)
+                dst[i] = 0.f;
+            for (size_t inIdx = 0lu; inIdx < indicesSize && _jitWorkAmount < _embDepth; inIdx++) {
+                float factor = weights ? weights[inIdx] : 1.f;
+                if (scales && _perRowScales)
+                    factor *= scales[indices[inIdx]];
+                const uint8_t* row = srcData + indices[inIdx] * rowSizeB;
+                for (size_t i = _jitWorkAmount; i < _embDepth; i++)
+                    dst[i] += tableValue(row, i, srcPrc) * factor;
+            }
+            if (scales && !_perRowScales) {
+                for (size_t i = _jitWorkAmount; i < _embDepth; i++)
+                    dst[i] *= scales[0];
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    // fp32 rows are accumulated by the JIT kernel, the rest of the precisions are processed by the reference code
+    if (isTableDecompressionSupported() && getOutputPrecision(srcPrc) == Precision::FP32) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
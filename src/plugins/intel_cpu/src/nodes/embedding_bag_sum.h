@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -28,6 +29,12 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    // The fp32 table and the tables which are converted to fp32 on the fly are accumulated by the JIT kernel.
+    static bool isTableDecompressionSupported();
+    // Fuses the dequantization of the compressed table: Convert to fp32 and the optional multiplication
+    // by the scale, which is either common for the table or a scale per row.
+    void fuseTableDecompression(const std::vector<float>& scales, bool perRowScales);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -37,11 +44,16 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& tableStaticShape, const InferenceEngine::Precision& tablePrc);
+    InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrc) const;
+    // The JIT kernel is reported for the tables which are accumulated by it, the rest are processed by the reference code
+    impl_desc_type getImplType(const InferenceEngine::Precision& tablePrc) const;
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision &srcPrc,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +63,17 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    bool _withTableDecompression = false;
+    bool _perRowScales = false;
+    std::vector<float> _tableScales;
+
+    // Part of the row processed by the kernels, the rest is accumulated by the scalar code.
+    size_t _jitWorkAmount = 0;
+    size_t _jitEmbDepth = 0;
+    std::shared_ptr<jitEmbeddingBagKernelBase> _jitKernel;
+    // Bags with the default index are not weighted.
+    std::shared_ptr<jitEmbeddingBagKernelBase> _jitKernelNoWeights;
 };
 
 }   // namespace node
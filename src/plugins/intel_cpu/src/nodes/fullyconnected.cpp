@@ -9,7 +9,12 @@
 #include "input.h"
 #include "reorder.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
+#include "common/dequantizing_gemm.h"
+#include "utils/bfloat16.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <algorithm>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -224,6 +229,21 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (weightsDecompression) {
+        const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID);
+        if (weightsShape.getRank() != 2 || !weightsShape.isStatic() || getInputShapeAtPort(DATA_ID).getRank() == 4)
+            IE_THROW() << errorPrefix << " supports weights decompression only for 2D weights";
+        if (weightsShape.getStaticDims()[1] % decompressionGroupsNum != 0)
+            IE_THROW() << errorPrefix << " has the number of input channels, which is not divisible by the number of groups";
+        // the small batches are run by the dequantizing kernel, the larger ones by oneDNN primitive created in prepareParams
+        const auto outputPrecision = fusedWith.empty() ? getOriginalOutputPrecisionAtPort(0)
+                                                       : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+        outputDataType = outputPrecision == Precision::BF16 && getDecompressedWeightsPrecision() == Precision::BF16
+                             ? memory::data_type::bf16
+                             : memory::data_type::f32;
+        return;
+    }
+
     useSparseWeights = useSparseWeightsDecompression();
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
@@ -283,11 +303,24 @@ void FullyConnected::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
 
+    if (weightsDecompression) {
+        const size_t K = getInputShapeAtPort(WEIGHTS_ID).getStaticDims()[1];
+        useDecompressionKernel = srcMemPtr->GetShape().getElementsCount() / K < dequantizing_gemm::largeM;
+        if (useDecompressionKernel) {
+            selected_pd->setImplementationType(impl_desc_type::ref);
+            return;
+        }
+    }
+
     AttrPtr attr = std::make_shared<dnnl::primitive_attr>();
     setPostOps(*attr, dstMemPtr->getStaticDims());
     (*attr).set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
-    DnnlMemoryDescPtr weightDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
+    // the decompressed weights are plain, the format is not chosen by oneDNN
+    DnnlMemoryDescPtr weightDesc = weightsDecompression
+        ? DnnlMemoryDescPtr(std::make_shared<DnnlBlockedMemoryDesc>(getDecompressedWeightsPrecision(),
+                                                                    getInputShapeAtPort(WEIGHTS_ID)))
+        : MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
     DnnlMemoryDescCPtr biasDesc = nullptr;
     if (biasMemPtr) {
         biasDesc = biasMemPtr->GetDescWithType<DnnlMemoryDesc>();
@@ -296,13 +329,13 @@ void FullyConnected::prepareParams() {
     DnnlMemoryDescCPtr inDesc = srcMemPtr->GetDescWithType<DnnlMemoryDesc>();
     DnnlMemoryDescCPtr outDesc = dstMemPtr->GetDescWithType<DnnlMemoryDesc>();
 
-    useConv1x1 = canBeExecutedInConv1x1();
+    useConv1x1 = !weightsDecompression && canBeExecutedInConv1x1();
     FCKey key = {inDesc,
                  weightDesc,
                  biasDesc,
                  outDesc,
                  *attr,
-                 implementationTypeIP,
+                 weightsDecompression ? impl_desc_type::undef : implementationTypeIP,
                  useConv1x1};
 
     auto engine = getEngine();
@@ -366,7 +399,8 @@ void FullyConnected::prepareParams() {
             while (static_cast<bool>(itpd))  {
                 impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
-                if (impl_type == key.implType) {
+                // the undefined type takes the first implementation, the best one according to oneDNN
+                if (impl_type == key.implType || key.implType == impl_desc_type::undef) {
                     prim_desc = itpd.get();
                     break;
                 }
@@ -441,6 +475,10 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (weightsDecompression && useDecompressionKernel) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't set dynamic batch for FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -472,6 +510,10 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (weightsDecompression && useDecompressionKernel) {
+        executeWithWeightsDecompression();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -501,9 +543,104 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the dequantizing kernel has no post ops, so they are fused only if oneDNN primitive runs all the batches
+    if (weightsDecompression && canUseDecompressionKernel())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
+bool FullyConnected::canUseDecompressionKernel() const {
+    const auto& minDims = getInputShapeAtPort(DATA_ID).getMinDims();
+    const size_t minM = std::accumulate(minDims.begin(), minDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    return minM < dequantizing_gemm::largeM;
+}
+
+Precision FullyConnected::getDecompressedWeightsPrecision() const {
+    return getOriginalInputPrecisionAtPort(DATA_ID) == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+}
+
+MemoryPtr FullyConnected::getDecompressedWeights() {
+    const auto& weiMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& weiDims = weiMem.getStaticDims();
+    const size_t N = weiDims[0];
+    const size_t K = weiDims[1];
+    auto create = [&] () {
+        const DecompressionWeights weights{weiMem.GetPtr(),
+                                           weiMem.getDesc().getPrecision() == Precision::I8,
+                                           decompressionScales.data(),
+                                           decompressionZeroPoints.empty() ? nullptr : decompressionZeroPoints.data(),
+                                           K / decompressionGroupsNum};
+        const auto precision = getDecompressedWeightsPrecision();
+        MemoryPtr memory = std::make_shared<Memory>(getEngine());
+        memory->Create(std::make_shared<DnnlBlockedMemoryDesc>(precision, getInputShapeAtPort(WEIGHTS_ID)));
+        if (precision == Precision::BF16)
+            decompressWeights(weights, N, K, static_cast<bfloat16_t*>(memory->GetPtr()));
+        else
+            decompressWeights(weights, N, K, static_cast<float*>(memory->GetPtr()));
+        return memory;
+    };
+
+    // the streams share the decompressed weights
+    auto weightCache = context->getWeightsCache();
+    if (weightCache) {
+        char ptr[32];
+        snprintf(ptr, sizeof ptr, "%p", weiMem.GetPtr());
+        return *weightCache->findOrCreate(getName() + "_decompressed_" + ptr, create);
+    }
+    return create();
+}
+
+void FullyConnected::fuseWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groupsNum) {
+    weightsDecompression = true;
+    decompressionScales = std::move(scales);
+    decompressionZeroPoints = std::move(zeroPoints);
+    decompressionGroupsNum = groupsNum;
+}
+
+bool FullyConnected::isWeightsDecompressionSupported(Precision activationsPrecision,
+                                                     size_t activationsRank,
+                                                     Precision weightsPrecision,
+                                                     const std::vector<Precision>& parametersPrecisions) {
+    if (!one_of(activationsPrecision, Precision::FP32, Precision::BF16) || activationsRank == 4 ||
+        !one_of(weightsPrecision, Precision::I8, Precision::U8))
+        return false;
+    return std::all_of(parametersPrecisions.begin(), parametersPrecisions.end(), [](Precision precision) {
+        return one_of(precision, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8);
+    });
+}
+
+void FullyConnected::executeWithWeightsDecompression() {
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    const auto& weiMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory();
+    const auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+
+    const auto& weiDims = weiMem.getStaticDims();
+    const size_t N = weiDims[0];
+    const size_t K = weiDims[1];
+    const size_t M = srcMem.GetShape().getElementsCount() / K;
+    const float* bias = withBiases ? static_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemory().GetPtr()) : nullptr;
+
+    const DecompressionWeights weights{weiMem.GetPtr(),
+                                       weiMem.getDesc().getPrecision() == Precision::I8,
+                                       decompressionScales.data(),
+                                       decompressionZeroPoints.empty() ? nullptr : decompressionZeroPoints.data(),
+                                       K / decompressionGroupsNum};
+
+    const auto srcPrecision = srcMem.getDesc().getPrecision();
+    const auto dstPrecision = dstMem.getDesc().getPrecision();
+    const void* src = srcMem.GetPtr();
+    void* dst = dstMem.GetPtr();
+    if (srcPrecision == Precision::BF16 && dstPrecision == Precision::BF16) {
+        dequantizingGemm(static_cast<const bfloat16_t*>(src), static_cast<bfloat16_t*>(dst), bias, M, N, K, weights);
+    } else if (srcPrecision == Precision::BF16) {
+        dequantizingGemm(static_cast<const bfloat16_t*>(src), static_cast<float*>(dst), bias, M, N, K, weights);
+    } else if (dstPrecision == Precision::BF16) {
+        dequantizingGemm(static_cast<const float*>(src), static_cast<bfloat16_t*>(dst), bias, M, N, K, weights);
+    } else {
+        dequantizingGemm(static_cast<const float*>(src), static_cast<float*>(dst), bias, M, N, K, weights);
+    }
+}
+
 void FullyConnected::setPostOps(dnnl::primitive_attr& attr, const VectorDims& dims_ext, bool initWeights) {
     dnnl::post_ops ops;
 
@@ -528,8 +665,9 @@ void FullyConnected::setPostOps(dnnl::primitive_attr& attr, const VectorDims& di
         IE_THROW() << "Unexpected rank(" << dims_ext.size() << ") for output tensor of node: " << getName();
     }
 
-    bool isINT8 = getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::U8 ||
-                  getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8;
+    // the compressed weights are decompressed to the precision of the source
+    bool isINT8 = !weightsDecompression && (getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::U8 ||
+                                            getOriginalInputPrecisionAtPort(WEIGHTS_ID) == Precision::I8);
 
     DnnlPostOpsComposer dnnlpoc(getEngine(), attr, ops, postOpsArgs, dims, dims.size() - 1, isINT8);
 
@@ -684,6 +822,19 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (weightsDecompression) {
+        auto toSupported = [](Precision prc) {
+            return prc == Precision::BF16 ? Precision::BF16 : Precision::FP32;
+        };
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, toSupported(getOriginalInputPrecisionAtPort(DATA_ID))},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, DnnlExtensionUtils::DataTypeToIEPrecision(outputDataType)}},
+                             impl_desc_type::ref);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -775,6 +926,8 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
 
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
+    if (weightsDecompression)
+        return;
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
     // if convolution selected the reorder for ip is useless. Will do the reoder for ip in prepareParams
@@ -905,6 +1058,13 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto blob = getParentEdgeAt(1)->getMemoryPtr();
     if (!blob)
         IE_THROW() << "Cannot get const weights blob for node " << getName() << ".";
+    if (weightsDecompression) {
+        // oneDNN primitive gets the plain decompressed weights as is
+        auto& decompressed = privateWeightCache[weightDesc->serializeFormat()];
+        if (!decompressed)
+            decompressed = getDecompressedWeights();
+        return decompressed;
+    }
 
     auto constDnnlMemOutDesc = blob->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
@@ -928,22 +1088,24 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
     } else {
-        auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
-            const std::string string_hash = getName() + "_" + format
-                                            + "_" + std::to_string(blob->GetSize())
-                                            + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
-
-            ptr = *weightCache->findOrCreate(string_hash, create);
-        } else {
-            ptr = create();
-        }
+        // the other compiled models of the same model share the repacked weights
+        const auto key = WeightsSharing::packedWeightsKey(weightSrcDesc, blob->GetData(), blob->GetSize(),
+                                                          weightDesc->getDnnlDesc());
+        const std::shared_ptr<const void> source(blob, blob->GetData());
+        ptr = *context->getPackedWeightsCache()->findOrCreatePacked(key, create, source, blob->GetSize());
         privateWeightCache[format] = ptr;
     }
 
     return ptr;
 }
 
+std::vector<MemoryCPtr> FullyConnected::getInternalMemory() const {
+    auto memory = Node::getInternalMemory();
+    for (const auto& weights : privateWeightCache)
+        memory.push_back(weights.second);
+    return memory;
+}
+
 bool FullyConnected::useSparseWeightsDecompression() {
     // minSparseRate == 1 means that sparse feature is switched off
     if (minSparseRate == 1.f) {
@@ -59,6 +59,29 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    std::vector<MemoryCPtr> getInternalMemory() const override;
+
+    /**
+     * The weights are kept as i8/u8 constant and dequantized by the node on the fly:
+     * W[n, k] = (w[n, k] - zeroPoints[n, g]) * scales[n, g], where g = k / (K / groupsNum).
+     * @param scales      [N, groupsNum]
+     * @param zeroPoints  [N, groupsNum] or empty
+     */
+    void fuseWeightsDecompression(std::vector<float> scales, std::vector<float> zeroPoints, size_t groupsNum);
+    /**
+     * Checks that the weights decompression is implemented for the given precisions, the precisions are the ones
+     * of the CPU graph. MarkMatMulWeightsDecompression keeps the weights compressed only when it returns true,
+     * so the decompression subgraph is always fused by GraphOptimizer::FuseFCAndWeightsDecompression.
+     * @param parametersPrecisions  precisions of the scale and the zero point constants
+     */
+    static bool isWeightsDecompressionSupported(InferenceEngine::Precision activationsPrecision,
+                                                size_t activationsRank,
+                                                InferenceEngine::Precision weightsPrecision,
+                                                const std::vector<InferenceEngine::Precision>& parametersPrecisions);
+    bool withWeightsDecompression() const {
+        return weightsDecompression;
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -84,10 +107,9 @@ private:
     bool useConv1x1 = false;
     impl_desc_type implementationTypeIP;
     MemoryDescPtr weightDescIP;
-    // when weightCache is not enabled (such as stream=1), brgconv weights may change due to
-    // different shapes. Weights will be cached in privateWeightCache.
-    // When weightCache is enabled, it holds weight ptr reference since weightCache does not hold the
-    // reference
+    // brgconv weights may change due to different shapes, the weights of every format are cached
+    // in privateWeightCache. It also holds the weight ptr reference since the packed weights cache
+    // does not hold the reference
     std::unordered_map<std::string, MemoryPtr> privateWeightCache;
 
     class ExecutorInnerProduct : public DnnlExecutor {
@@ -114,6 +136,19 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+
+    // weights decompression
+    bool weightsDecompression = false;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    size_t decompressionGroupsNum = 1;
+    // the dequantizing kernel runs the small batches, the larger ones are run by oneDNN primitive
+    // with the weights decompressed once
+    bool useDecompressionKernel = false;
+    bool canUseDecompressionKernel() const;
+    InferenceEngine::Precision getDecompressedWeightsPrecision() const;
+    MemoryPtr getDecompressedWeights();
+    void executeWithWeightsDecompression();
 };
 
 }   // namespace node
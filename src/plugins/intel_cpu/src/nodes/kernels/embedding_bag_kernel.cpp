@@ -0,0 +1,177 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl::cpu;
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jEmbeddingBagCallArgs, field)
+
+template <x64::cpu_isa_t isa>
+jitUniEmbeddingBagKernel<isa>::jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp) :
+        jitEmbeddingBagKernelBase(jcp), x64::jit_generator(jit_name()) {
+    dataElPerVec = vlen / sizeof(float);
+    tableTypeSize = jcp.tablePrc.size();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::create_ker() {
+    auto code = x64::jit_generator::create_kernel();
+    if (code != dnnl::impl::status::success)
+        IE_THROW() << "Could not create EmbeddingBag kernel. Error code: " << std::to_string(code);
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::generate() {
+    this->preamble();
+
+    mov(regTable, ptr[regParams + GET_OFF(table)]);
+    mov(regIndices, ptr[regParams + GET_OFF(indices)]);
+    mov(regDst, ptr[regParams + GET_OFF(dst)]);
+    mov(regIndicesNum, ptr[regParams + GET_OFF(indicesNum)]);
+    if (jcp.withWeights)
+        mov(regWeights, ptr[regParams + GET_OFF(weights)]);
+    if (jcp.withRowScales || jcp.withScale)
+        mov(regScales, ptr[regParams + GET_OFF(scales)]);
+    if (jcp.withScale)
+        uni_vbroadcastss(vmmScale, ptr[regScales]);
+
+    const uint64_t blockSize = unroll * dataElPerVec;
+    const uint64_t blocksNum = jcp.workAmount / blockSize;
+    const uint32_t restVecNum = static_cast<uint32_t>((jcp.workAmount % blockSize) / dataElPerVec);
+
+    xor_(regRowOffset, regRowOffset);
+    if (blocksNum > 0) {
+        Xbyak::Label lBlockLoop;
+        mov(regBlocks, blocksNum);
+        L(lBlockLoop);
+        {
+            processBlock(unroll);
+
+            add(regRowOffset, blockSize * tableTypeSize);
+            add(regDst, blockSize * sizeof(float));
+            dec(regBlocks);
+            jnz(lBlockLoop, T_NEAR);
+        }
+    }
+    if (restVecNum > 0)
+        processBlock(restVecNum);
+
+    this->postamble();
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::processBlock(uint32_t vecNum) {
+    Xbyak::Label lIdxLoop, lIdxLoopEnd;
+
+    for (uint32_t v = 0; v < vecNum; v++)
+        uni_vpxor(Vmm(v), Vmm(v), Vmm(v));
+
+    mov(regIdxPtr, regIndices);
+    mov(regIdxIter, regIndicesNum);
+    if (jcp.withWeights)
+        mov(regWeightsPtr, regWeights);
+
+    L(lIdxLoop);
+    {
+        cmp(regIdxIter, 0);
+        je(lIdxLoopEnd, T_NEAR);
+
+        if (jcp.prefetchDistance > 0)
+            prefetchRow(vecNum);
+
+        movsxd(regRow, ptr[regIdxPtr]);
+        const bool withFactor = jcp.withWeights || jcp.withRowScales;
+        if (jcp.withRowScales) {
+            uni_vbroadcastss(vmmFactor, ptr[regScales + regRow * sizeof(float)]);
+            if (jcp.withWeights) {
+                uni_vbroadcastss(vmmAux, ptr[regWeightsPtr]);
+                uni_vmulps(vmmFactor, vmmFactor, vmmAux);
+            }
+        } else if (jcp.withWeights) {
+            uni_vbroadcastss(vmmFactor, ptr[regWeightsPtr]);
+        }
+        imul(regRow, regRow, static_cast<int>(jcp.rowSize * tableTypeSize));
+        add(regRow, regTable);
+
+        for (uint32_t v = 0; v < vecNum; v++) {
+            const Vmm vmmSrc = Vmm(unroll + v);
+            loadRow(vmmSrc, ptr[regRow + regRowOffset + v * dataElPerVec * tableTypeSize]);
+            if (withFactor)
+                uni_vfmadd231ps(Vmm(v), vmmSrc, vmmFactor);
+            else
+                uni_vaddps(Vmm(v), Vmm(v), vmmSrc);
+        }
+
+        add(regIdxPtr, sizeof(int));
+        if (jcp.withWeights)
+            add(regWeightsPtr, sizeof(float));
+        dec(regIdxIter);
+        jmp(lIdxLoop, T_NEAR);
+    }
+    L(lIdxLoopEnd);
+
+    for (uint32_t v = 0; v < vecNum; v++) {
+        if (jcp.withScale)
+            uni_vmulps(Vmm(v), Vmm(v), vmmScale);
+        uni_vmovups(ptr[regDst + v * vlen], Vmm(v));
+    }
+}
+
+// Prefetches the part of the row processed by the current block for the index which is prefetchDistance ahead.
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::prefetchRow(uint32_t vecNum) {
+    Xbyak::Label lNoPrefetch;
+
+    cmp(regIdxIter, jcp.prefetchDistance);
+    jle(lNoPrefetch, T_NEAR);
+
+    movsxd(regAux, ptr[regIdxPtr + jcp.prefetchDistance * sizeof(int)]);
+    imul(regAux, regAux, static_cast<int>(jcp.rowSize * tableTypeSize));
+    add(regAux, regTable);
+    const uint64_t blockBytes = vecNum * dataElPerVec * tableTypeSize;
+    for (uint64_t offset = 0; offset < blockBytes; offset += cacheLineSize)
+        prefetcht0(ptr[regAux + regRowOffset + offset]);
+    if (jcp.withRowScales) {
+        movsxd(regAux, ptr[regIdxPtr + jcp.prefetchDistance * sizeof(int)]);
+        prefetcht0(ptr[regScales + regAux * sizeof(float)]);
+    }
+
+    L(lNoPrefetch);
+}
+
+template <x64::cpu_isa_t isa>
+void jitUniEmbeddingBagKernel<isa>::loadRow(const Vmm& vDst, const Xbyak::Address& srcAddr) {
+    switch (jcp.tablePrc) {
+        case Precision::FP32:
+            uni_vmovups(vDst, srcAddr);
+            break;
+        case Precision::BF16:
+            uni_vpmovzxwd(vDst, srcAddr);
+            uni_vpslld(vDst, vDst, 16);
+            break;
+        case Precision::I8:
+            uni_vpmovsxbd(vDst, srcAddr);
+            uni_vcvtdq2ps(vDst, vDst);
+            break;
+        case Precision::U8:
+            uni_vpmovzxbd(vDst, srcAddr);
+            uni_vcvtdq2ps(vDst, vDst);
+            break;
+        default:
+            IE_THROW() << "EmbeddingBag kernel does not support table precision " << jcp.tablePrc.name();
+    }
+}
+
+template struct jitUniEmbeddingBagKernel<x64::avx2>;
+template struct jitUniEmbeddingBagKernel<x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
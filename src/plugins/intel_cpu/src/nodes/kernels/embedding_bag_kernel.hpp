@@ -0,0 +1,111 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// EmbeddingBag kernel accumulates the table rows selected by the bag indices into one fp32 output row.
+// The row is processed by blocks of several vector registers: the block of accumulators stays in registers
+// while the kernel walks over the bag indices, so every output element is written once.
+// The rows of the upcoming indices are prefetched ahead, because the rows are spread across the whole table
+// and the hardware prefetcher can not predict them.
+//
+//          SUPPORTED TABLE PRECISIONS
+//----------------------------------------------
+//          |  FP32  |  BF16  |   I8   |   U8   |
+//  AVX512  |   X    |   X    |   X    |   X    |
+//  AVX2    |   X    |   X    |   X    |   X    |
+//----------------------------------------------
+// BF16 and integer rows are converted to fp32 in registers, integer rows may be dequantized by the per row scale.
+// Only the part of the row which is multiple of the vector length is processed, the rest is left to the caller.
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <ie_precision.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jEmbeddingBagConfParams {
+    InferenceEngine::Precision tablePrc = InferenceEngine::Precision::FP32;
+    uint64_t rowSize = 0lu;          // elements in the table row
+    uint64_t workAmount = 0lu;       // elements of the row processed by the kernel, multiple of the vector length
+    bool withWeights = false;        // per sample weights
+    bool withRowScales = false;      // per row dequantization scales
+    bool withScale = false;          // dequantization scale common for the whole table
+    uint64_t prefetchDistance = 0lu; // in indices, 0 disables the prefetch
+};
+
+struct jEmbeddingBagCallArgs {
+    const void* table;
+    const int* indices;
+    const float* weights;
+    const float* scales;
+    float* dst;
+    uint64_t indicesNum = 0lu;
+};
+
+struct jitEmbeddingBagKernelBase {
+    void (*ker_)(const jEmbeddingBagCallArgs *);
+    void operator()(const jEmbeddingBagCallArgs *args) {
+        assert(ker_);
+        ker_(args);
+    }
+    explicit jitEmbeddingBagKernelBase(const jEmbeddingBagConfParams& jcp) : ker_(nullptr), jcp(jcp) {}
+    virtual ~jitEmbeddingBagKernelBase() {}
+
+    virtual void create_ker() = 0;
+    uint64_t getDataElPerVec() const {
+        return dataElPerVec;
+    }
+
+protected:
+    jEmbeddingBagConfParams jcp;
+    uint64_t dataElPerVec = 0lu;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jitUniEmbeddingBagKernel : public jitEmbeddingBagKernelBase, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jitUniEmbeddingBagKernel)
+
+    explicit jitUniEmbeddingBagKernel(const jEmbeddingBagConfParams& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+protected:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static const uint32_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    static const uint32_t cacheLineSize = 64;
+    // The number of vector registers in the block of accumulators.
+    static const uint32_t unroll = 4;
+    uint64_t tableTypeSize = 4lu;
+
+    // 64b registers.
+    const Xbyak::Reg64& regTable = r8;
+    const Xbyak::Reg64& regIndices = r9;
+    const Xbyak::Reg64& regWeights = r10;
+    const Xbyak::Reg64& regScales = r11;
+    const Xbyak::Reg64& regDst = r12;
+    const Xbyak::Reg64& regIndicesNum = r13;
+    const Xbyak::Reg64& regIdxIter = r14;
+    const Xbyak::Reg64& regIdxPtr = r15;
+    const Xbyak::Reg64& regWeightsPtr = rbx;
+    const Xbyak::Reg64& regRowOffset = rsi;
+    const Xbyak::Reg64& regRow = rax;
+    const Xbyak::Reg64& regAux = rdx;
+    const Xbyak::Reg64& regBlocks = rbp;
+
+    const Xbyak::Reg64 regParams = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // Accumulators occupy Vmm(0)..Vmm(unroll - 1), loaded rows Vmm(unroll)..Vmm(2 * unroll - 1).
+    Vmm vmmFactor = Vmm(2 * unroll);
+    Vmm vmmScale = Vmm(2 * unroll + 1);
+    Vmm vmmAux = Vmm(2 * unroll + 2);
+
+    void processBlock(uint32_t vecNum);
+    void prefetchRow(uint32_t vecNum);
+    void loadRow(const Vmm& vDst, const Xbyak::Address& srcAddr);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
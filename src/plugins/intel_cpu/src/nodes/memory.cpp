@@ -3,6 +3,7 @@
 //
 
 #include <string>
+#include <utility>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
@@ -80,6 +81,9 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
 }
 
 void MemoryOutput::execute(dnnl::stream strm)  {
+    if (residentState)
+        return;
+
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
@@ -158,6 +162,10 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::swapStore(MemoryPtr& mem) {
+    std::swap(dataStore, mem);
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
@@ -166,6 +174,9 @@ void MemoryInput::storeState(const Memory &new_state) {
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    if (residentState)
+        return;
+
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
@@ -76,12 +76,20 @@ public:
         inputNode = node;
     }
 
+    /**
+     * @brief The producer writes the state to the store of the input sibling itself, so there is nothing to copy
+     */
+    void setResidentState() {
+        residentState = true;
+    }
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    bool residentState = false;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -103,8 +111,21 @@ public:
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+
+    /**
+     * @brief The consumer reads the state from the store directly, so the copy to the output edge is skipped
+     */
+    void setResidentState() {
+        residentState = true;
+    }
+    /**
+     * @brief Replaces the store by the memory with the same descriptor, which holds the new state
+     */
+    void swapStore(MemoryPtr& mem);
+
  private:
     MemoryPtr dataStore;
+    bool residentState = false;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
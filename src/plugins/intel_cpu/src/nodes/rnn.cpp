@@ -9,6 +9,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "utils/bfloat16.hpp"
 #include "input.h"
+#include "memory.hpp"
 #include <dnnl_extension_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
@@ -727,6 +728,8 @@ void RNN::fillWeights(const int *gate_map, const size_t wIdx, const size_t rIdx)
 
     internalBlobs.push_back(w_data_mem);
     internalBlobs.push_back(w_state_mem);
+    internalBlobPorts.push_back(wIdx);
+    internalBlobPorts.push_back(rIdx);
 }
 
 template <Precision::ePrecision Prec>
@@ -763,6 +766,7 @@ void RNN::fillBiases(const int *gate_map) {
     }
     // @todo replace push_back with copy assignment by index, since order matters
     internalBlobs.push_back(w_bias_data_mem);
+    internalBlobPorts.push_back(bIdx);
 }
 
 void RNN::copyWeightsData() {
@@ -1100,6 +1104,49 @@ std::shared_ptr<MemoryDesc> RNN::getDstMemDesc(dnnl::primitive_desc_iterator& pr
     return supportedPrimitiveDescriptors[0].getConfig().outConfs[idx].getMemDesc();
 }
 
+void RNN::createPrimitive() {
+    Node::createPrimitive();
+    bindResidentStates();
+}
+
+void RNN::bindResidentStates() {
+    residentStates.assign(S, nullptr);
+    residentStatesSpare.assign(S, nullptr);
+    if (isDynamicNode())
+        return;
+
+    for (size_t s = 0; s < S; s++) {
+        const size_t outPort = is_cell ? s : s + 1;
+        if (outPort >= outputShapes.size())
+            continue;
+
+        const auto inEdge = getParentEdgeAt(s + 1);
+        auto memInput = dynamic_cast<MemoryInput*>(inEdge->getParent().get());
+        if (!memInput || memInput->getChildEdges().size() != 1)
+            continue;
+
+        const auto outEdges = getChildEdgesAtPort(outPort);
+        if (outEdges.size() != 1)
+            continue;
+        auto memOutput = dynamic_cast<MemoryOutput*>(outEdges[0]->getChild().get());
+        if (!memOutput || memOutput->getId() != memInput->getId())
+            continue;
+
+        // the primitive uses the store in place of the edges, so the layouts have to be the same
+        const auto& storeDesc = memInput->getStore()->getDesc();
+        if (!inEdge->getMemory().getDesc().isCompatible(storeDesc) ||
+            !outEdges[0]->getMemory().getDesc().isCompatible(storeDesc))
+            continue;
+
+        auto spare = std::make_shared<Memory>(getEngine());
+        spare->Create(storeDesc);
+        residentStates[s] = memInput;
+        residentStatesSpare[s] = spare;
+        memInput->setResidentState();
+        memOutput->setResidentState();
+    }
+}
+
 void RNN::execute(dnnl::stream strm) {
     if (!prim)
         THROW_ERROR << "does not have initialized primitive to execute.";
@@ -1123,7 +1170,8 @@ void RNN::execute(dnnl::stream strm) {
     int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
     int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
     for (size_t s = 0; s < S; s++) {
-        args[state_i_tags[s]] = getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
+        args[state_i_tags[s]] = residentStates[s] ? residentStates[s]->getStore()->GetPrimitive()
+                                                  : getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
     }
     if (is_augru) {
         const auto atten_port = is_cell ? 5 : 6;
@@ -1132,18 +1180,26 @@ void RNN::execute(dnnl::stream strm) {
 
     if (is_cell) {
         for (size_t s = 0; s < S; s++) {
-            args[state_o_tags[s]] = getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive();
+            args[state_o_tags[s]] = residentStates[s] ? residentStatesSpare[s]->GetPrimitive()
+                                                      : getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive();
         }
     } else {
         size_t n_ports_with_init_states = outputShapes.size() - 1; // first is a sequence data
         for (size_t s = 0; s < std::min(S, n_ports_with_init_states); s++) {
             if (s < outputShapes.size()) {
-                args[state_o_tags[s]] = getChildEdgesAtPort(s+1)[0]->getMemoryPtr()->GetPrimitive();
+                args[state_o_tags[s]] = residentStates[s] ? residentStatesSpare[s]->GetPrimitive()
+                                                          : getChildEdgesAtPort(s+1)[0]->getMemoryPtr()->GetPrimitive();
             }
         }
     }
 
     prim.execute(strm, args);
+
+    // the new state becomes the store of the variable, the previous one is overwritten by the next inference
+    for (size_t s = 0; s < S; s++) {
+        if (residentStates[s])
+            residentStates[s]->swapStore(residentStatesSpare[s]);
+    }
 }
 
 void RNN::executeDynamicImpl(dnnl::stream strm) {
@@ -1153,6 +1209,7 @@ void RNN::executeDynamicImpl(dnnl::stream strm) {
 void RNN::cleanup() {
     if (!isDynamicNode()) {
         internalBlobs.clear();
+        internalBlobPorts.clear();
     }
 
     for (auto it : fusedWith) {
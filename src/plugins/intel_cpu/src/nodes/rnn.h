@@ -15,6 +15,8 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+class MemoryInput;
+
 class RNN : public Node {
 public:
     RNN(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
@@ -30,6 +32,7 @@ public:
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     std::shared_ptr<dnnl::primitive_attr> initPrimitiveAttr() override;
 
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
 
     inline bool hasNativeOrder() const {
@@ -58,6 +61,7 @@ private:
     void fillBiases(const int* gate_map);
 
     void copyWeightsData();
+    void bindResidentStates();
 
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
@@ -141,6 +145,11 @@ private:
     bool wasMemoryPrepared = false;
     MemoryPtr scratchpadMem;
 
+    // The states read from ReadValue and written to Assign of the same variable stay in the store of the MemoryInput node
+    // between the inferences: the primitive reads the store and writes the new state to the spare memory, then they are swapped.
+    std::vector<MemoryInput*> residentStates;
+    std::vector<MemoryPtr> residentStatesSpare;
+
     float inputScale    = 0.f;
     float inputShift    = 0.f;
     std::vector<float> weightsScales;
@@ -21,6 +21,7 @@
 #include <ie_ngraph_utils.hpp>
 
 #include <snippets/op/subgraph.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/cpu_generator.hpp"
 #include "utils/cpu_utils.hpp"
 #include "snippets_transformations/fuse_load_store_and_convert.hpp"
@@ -35,7 +36,40 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+struct SnippetKey {
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    // only the dims processed inside the kernel, the outer dims are scheduled with runtime offsets
+    VectorDims masterTile;
+    std::vector<VectorDims> ioTiles;
+    std::vector<InferenceEngine::Precision> ioPrecisions;
+    size_t tileRank;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = hash_combine(seed, snippet.get());
+        seed = get_vector_hash(seed, masterTile);
+        for (const auto& tile : ioTiles)
+            seed = get_vector_hash(seed, tile);
+        for (const auto& precision : ioPrecisions)
+            seed = hash_combine(seed, precision.getPrecVal());
+        seed = hash_combine(seed, tileRank);
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return snippet == rhs.snippet &&
+               masterTile == rhs.masterTile &&
+               ioTiles == rhs.ioTiles &&
+               ioPrecisions == rhs.ioPrecisions &&
+               tileRank == rhs.tileRank;
+    }
+};
 
+} // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
         : Node(op, context, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
@@ -47,7 +81,7 @@ Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CP
     }
 }
 
-void Snippet::copy_snippet() {
+std::shared_ptr<ngraph::snippets::op::Subgraph> Snippet::copy_snippet() const {
     ngraph::OutputVector subgraph_node_inputs;
     for (const auto &input : original_snippet->input_values()) {
         auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
@@ -61,15 +95,16 @@ void Snippet::copy_snippet() {
     } else {
         new_body = original_snippet->body_ptr()->clone();
     }
-    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-    ngraph::copy_runtime_info(original_snippet, snippet);
-    snippet->set_friendly_name(original_snippet->get_friendly_name());
-    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
-    isa_num_lanes =  snippet->get_generator()->get_target_machine()->get_lanes();
+    auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original_snippet, subgraph);
+    subgraph->set_friendly_name(original_snippet->get_friendly_name());
+    subgraph->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    return subgraph;
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
-    copy_snippet();
+    snippet = copy_snippet();
+    isa_num_lanes =  snippet->get_generator()->get_target_machine()->get_lanes();
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
@@ -85,17 +120,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
 
     const size_t ndims = outputShapes[0].getRank();
     // Domain sensitive operations support only Planar layout
-    const bool isOnlyPlanarApplicable = snippet->has_domain_sensitive_ops();
+    // Dynamic shapes are supported only for Planar layout too, since shapeInfer works with planar dims
+    const bool isOnlyPlanarApplicable = snippet->has_domain_sensitive_ops() || isDynamic;
     const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 3, 4, 5) && dimRanksAreEqual && !isOnlyPlanarApplicable;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !isOnlyPlanarApplicable;
-
-    for (const auto& inShape : inputShapes) {
-        if (isDynamic && inShape.getRank() != 1)
-            isBlockedApplicable = isBlockedApplicable && inShape.getMinDims()[1] != Shape::UNDEFINED_DIM && inShape.getMinDims()[1] > 1;
-    }
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !isOnlyPlanarApplicable;
 
     enum LayoutType {
         Planar,
@@ -278,7 +309,7 @@ bool Snippet::optimizeExecDomain(std::vector<VectorDims>& inputShapes, std::vect
     };
     return findDimsToCollapse();
 }
-ov::PartialShape Snippet::canonicalizeBody() {
+ov::PartialShape Snippet::canonicalizeBody(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
     auto edgeToBlockedShape = [](const EdgePtr& edge) {
         const auto blockedDesc = edge->getMemory().GetDescWithType<BlockedMemoryDesc>();
         std::vector<Dimension> dims;
@@ -308,13 +339,13 @@ ov::PartialShape Snippet::canonicalizeBody() {
         output_blocked_shapes.push_back(blockedShape);
     }
 
-    const auto& canonicalShape = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    const auto& canonicalShape = subgraph->canonicalize(output_blocked_shapes, input_blocked_shapes);
     return canonicalShape;
 }
 void Snippet::createPrimitive() {
     // determine canonicalize, determine master_shape and prepend up to 6D
     // NB! normInputShapes are updated, so body reshape might be needed
-    const auto& canonicalShape = canonicalizeBody();
+    const auto& canonicalShape = canonicalizeBody(snippet);
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), canonicalShape.size());
 
@@ -330,6 +361,16 @@ void Snippet::createPrimitive() {
     };
     initDataSizes();
 
+    if (isDynamic) {
+        // master and normalized shapes are set by shapeInfer, the kernel is generated in prepareParams
+        if (tensorRank > rank6D)
+            IE_THROW(NotImplemented) << "Subgraph node with name `" << getName() << "` supports dynamic shapes only up to "
+                                     << rank6D << "D, but got rank " << tensorRank;
+        normInputShapes.resize(inputShapes.size());
+        normOutputShapes.resize(outputShapes.size());
+        return;
+    }
+
     jit_snippets_compile_args jcp;
     if (canonicalShape.is_dynamic())
         IE_THROW() << "Snippets: Canonicalization returned dynamic shape in static pipeline";
@@ -343,8 +384,8 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+    jitKernel = generate(snippet, &jcp);
+    buffer_scratchpad_size = jitKernel->buffer_scratchpad_size;
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
@@ -457,16 +498,67 @@ void Snippet::prepareParams() {
         dim = 1;
     }
 
-    auto& body_rt_info = snippet->body_ptr()->get_rt_info();
-    std::vector<std::vector<size_t>> new_shapes(normInputShapes);
-    std::copy(normOutputShapes.begin(), normOutputShapes.end(), std::back_inserter(new_shapes));
-    body_rt_info["PluginShapesOverride"] = new_shapes;
-    snippet->set_master_shape(ov::PartialShape(masterShape));
-    snippet->set_tile_rank(tileRank);
+    if (isDynamic)
+        prepareDynamicKernel();
+}
+
+void Snippet::initDataOffsets() {
+    const size_t numInputs = normInputShapes.size();
+    dataOffsets.resize(numInputs + normOutputShapes.size());
+    // the same strides as KernelEmitter computes for the static shapes: the last dim is processed by the kernel,
+    // and the dims of size 1 get zero stride to be broadcasted
+    for (size_t i = 0; i < dataOffsets.size(); i++) {
+        const auto& shape = i < numInputs ? normInputShapes[i] : normOutputShapes[i - numInputs];
+        auto& offsets = dataOffsets[i];
+        offsets.fill(0);
+        size_t dimStep = 1;
+        for (int k = static_cast<int>(shape.size()) - 2; k >= 0; k--) {
+            dimStep *= shape[k + 1];
+            offsets[k] = shape[k] != 1 ? static_cast<int64_t>(dimStep * dataSize[i]) : 0;
+        }
+    }
+}
+
+void Snippet::prepareDynamicKernel() {
+    initDataOffsets();
+
+    auto tileDims = [this](const VectorDims& dims) {
+        return VectorDims(dims.end() - tileRank, dims.end());
+    };
+    SnippetKey key;
+    key.snippet = original_snippet;
+    key.masterTile = tileDims(masterShape);
+    for (const auto& shape : normInputShapes)
+        key.ioTiles.push_back(tileDims(shape));
+    for (const auto& shape : normOutputShapes)
+        key.ioTiles.push_back(tileDims(shape));
+    const auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    for (const auto& inConf : config.inConfs)
+        key.ioPrecisions.push_back(inConf.getMemDesc()->getPrecision());
+    for (const auto& outConf : config.outConfs)
+        key.ioPrecisions.push_back(outConf.getMemDesc()->getPrecision());
+    key.tileRank = tileRank;
+
+    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetJitKernel> {
+        // the body is lowered in place, so every kernel is generated from its own copy of the subgraph
+        auto subgraph = copy_snippet();
+        canonicalizeBody(subgraph);
+        jit_snippets_compile_args jcp;
+        jcp.master_shape = masterShape;
+        jcp.tile_rank = key.tileRank;
+        jcp.has_runtime_offsets = true;
+        return generate(subgraph, &jcp);
+    };
+
+    auto cache = context->getParamsCache();
+    auto result = cache->getOrCreate(key, builder);
+    jitKernel = result.first;
+    buffer_scratchpad_size = jitKernel->buffer_scratchpad_size;
+    buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
 bool Snippet::needPrepareParams() const {
-    return inputShapesModified() || !schedule.ptr;
+    return inputShapesModified() || !jitKernel;
 }
 
 bool Snippet::canBeInPlace() const {
@@ -498,7 +590,15 @@ bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
 
-void Snippet::generate(const jit_snippets_compile_args* jcp) {
+std::shared_ptr<Snippet::SnippetJitKernel> Snippet::generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph,
+                                                             const jit_snippets_compile_args* jcp) {
+    auto& body_rt_info = subgraph->body_ptr()->get_rt_info();
+    std::vector<std::vector<size_t>> new_shapes(normInputShapes);
+    std::copy(normOutputShapes.begin(), normOutputShapes.end(), std::back_inserter(new_shapes));
+    body_rt_info["PluginShapesOverride"] = new_shapes;
+    subgraph->set_master_shape(ov::PartialShape(masterShape));
+    subgraph->set_tile_rank(tileRank);
+
     ov::pass::Manager optManager;
     optManager.register_pass<ov::intel_cpu::pass::FuseLoadConvert>();
     optManager.register_pass<ov::intel_cpu::pass::FuseStoreConvert>();
@@ -519,7 +619,11 @@ void Snippet::generate(const jit_snippets_compile_args* jcp) {
                     return convert->get_input_element_type(0) != ov::element::f32;
                 return true;
             });
-    schedule = snippet->generate(optManager, reinterpret_cast<const void*>(jcp));
+    auto generated = std::make_shared<SnippetJitKernel>();
+    generated->schedule = subgraph->generate(optManager, reinterpret_cast<const void*>(jcp));
+    generated->buffer_scratchpad_size = subgraph->get_buffer_scratchpad_size();
+    generated->snippet = subgraph;
+    return generated;
 }
 
 void Snippet::update_ptrs(jit_snippets_call_args& call_args) {
@@ -533,10 +637,13 @@ void Snippet::update_ptrs(jit_snippets_call_args& call_args) {
         call_args.buffer_scratchpad_ptr =
                 reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
     }
+
+    for (size_t i = 0; i < dataOffsets.size(); i++)
+        std::copy(dataOffsets[i].begin(), dataOffsets[i].end(), call_args.data_offsets[i]);
 }
 
 void Snippet::execute(dnnl::stream strm) {
-    if (schedule.ptr == nullptr) {
+    if (!jitKernel || jitKernel->schedule.ptr == nullptr) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
     if (tensorRank == rank6D) {
@@ -546,8 +653,13 @@ void Snippet::execute(dnnl::stream strm) {
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 void Snippet::schedule_6d() {
     const auto& dom = exec_domain;
+    const auto callable = jitKernel->schedule.get_callable<kernel>();
     // < N, C, H, W > < 1, 1, N, C*H*W>
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
         [&](int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) {
@@ -555,12 +667,13 @@ void Snippet::schedule_6d() {
             jit_snippets_call_args call_args;
             update_ptrs(call_args);
 
-            schedule.get_callable<kernel>()(indexes, &call_args);
+            callable(indexes, &call_args);
         });
 }
 
 void Snippet::schedule_nt() {
     const auto& work_size = exec_domain;
+    const auto callable = jitKernel->schedule.get_callable<kernel>();
     parallel_nt(0, [&](const int ithr, const int nthr) {
         jit_snippets_call_args call_args;
         update_ptrs(call_args);
@@ -576,7 +689,7 @@ void Snippet::schedule_nt() {
                 tmp /= work_size[j];
             }
 
-            schedule.get_callable<kernel>()(indexes.data(), &call_args);
+            callable(indexes.data(), &call_args);
         }
     });
 }
@@ -47,22 +47,36 @@ public:
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
 
 private:
     static const size_t rank6D {6};
 
     typedef void (*kernel)(const void *, const void *);
 
+    // Generated code together with the lowered copy of the subgraph which owns it
+    struct SnippetJitKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+        size_t buffer_scratchpad_size = 0;
+    };
+
     // Create a deep local copy of the input snippet to perform canonicalization & code generation
     // TODO: Probably better to implement a proper copy constructor
     // NOTE: Before call mutex should be initialized
-    void copy_snippet();
+    std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet() const;
 
-    ov::PartialShape canonicalizeBody();
+    ov::PartialShape canonicalizeBody(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph);
     // returns true if exec domain was modified
     bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
-    void generate(const jit_snippets_compile_args*);
+    // Lowers the subgraph for the current normalized shapes and generates the kernel
+    std::shared_ptr<SnippetJitKernel> generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph,
+                                               const jit_snippets_compile_args*);
+    // Dynamic shapes: kernels depend only on the tile dims and are shared through the params cache,
+    // the strides of the outer dims are passed at runtime
+    void prepareDynamicKernel();
+    void initDataOffsets();
     inline void update_ptrs(jit_snippets_call_args&);
     // Evaluates generated snippet using parallel backend
     void schedule_6d();
@@ -74,7 +88,7 @@ private:
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
-    ngraph::snippets::Schedule schedule;
+    std::shared_ptr<SnippetJitKernel> jitKernel;
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
@@ -107,6 +121,8 @@ private:
 
     std::vector<ptrdiff_t> start_offset_in = {};
     std::vector<ptrdiff_t> start_offset_out = {};
+    // byte strides of the scheduled dims per input and output, passed to kernels with runtime offsets
+    std::vector<std::array<int64_t, SNIPPETS_MAX_HARNESS_DIMS>> dataOffsets = {};
 
     // Buffer scratchpad
     std::vector<uint8_t> buffer_scratchpad = {};
@@ -79,6 +79,46 @@ static void nullifyUndefinedDims(VectorDims& dims) {
     });
 }
 
+// the memory of the body input may be redirected to the outer data if none of the consumers writes into it
+static bool isBodyInputBindable(const NodePtr& input) {
+    const auto& mem = input->getChildEdgeAt(0)->getMemory();
+    // the dynamic memory manager is replaced on redirecting, so the memory stops being shared with the consumers
+    if (!mem.getDesc().isDefined() || !mem.getDnnlMemoryMngr()->hasExtBuffer())
+        return false;
+
+    for (const auto& childEdge : input->getChildEdges()) {
+        const auto& child = childEdge.lock()->getChild();
+        if (child->isConstant() || child->isInPlace() || one_of(child->getType(), Type::Concatenation, Type::Split))
+            return false;
+
+        for (const auto& edge : child->getChildEdges()) {
+            if (edge.lock()->getMemory().GetData() == mem.GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// the chunk of the full blob can be used by the body directly if it is a contiguous part of the plain blob
+static bool isChunkBindable(const MemoryPtr& full, const MemoryPtr& part, const PortMap& slice_rule) {
+    if (!full->getDesc().isDefined() || !part->getDesc().isDefined())
+        return false;
+
+    const auto prec = full->getDesc().getPrecision();
+    const auto& full_dims = full->getStaticDims();
+    auto part_dims = full_dims;
+    part_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+
+    // the full blob may be an in-place view with the offset, the chunks are addressed from its beginning
+    if (!full->GetDescWithType<BlockedMemoryDesc>()->isCompatible(CpuBlockedMemoryDesc(prec, full->GetShape()), BLOCKED_DESC_SKIP_OFFSET_MASK) ||
+        !part->GetDescWithType<BlockedMemoryDesc>()->isCompatible(CpuBlockedMemoryDesc(prec, Shape(part_dims)), BLOCKED_DESC_FULL_MASK))
+        return false;
+
+    return std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) {
+        return dim == 1;
+    });
+}
+
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, bool sliced_src,
@@ -146,6 +186,43 @@ private:
     int iter_count;
 };
 
+/**
+ * Redirects the body memory to the current chunk of the full blob instead of copying the chunk.
+ * The chunk has to be a contiguous part of the full blob, see isChunkBindable.
+ */
+class PortIteratorBindHelper : public PortMapHelper {
+public:
+    PortIteratorBindHelper(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule)
+                           : full_mem(full), part_mem(part) {
+        auto axis = slice_rule.axis;
+        auto stride = slice_rule.stride;
+        auto abs_stride = std::abs(stride);
+
+        iter_count = full->getStaticDims()[axis] / abs_stride;
+
+        auto elem_size = full->getDesc().getPrecision().size();
+        chunk_stride_in_byte = full->GetDescWithType<BlockedMemoryDesc>()->getStrides()[axis] * elem_size * abs_stride;
+        chunk_offset_in_byte = stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= stride < 0 ? -1 : 1;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        // the full blob may be rebound to the user tensor between the inferences, so its pointer is taken every time
+        part_mem->setDataHandle(static_cast<uint8_t *>(full_mem->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    MemoryPtr part_mem;
+
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -161,6 +238,27 @@ public:
     }
 };
 
+/**
+ * Exchanges the memory of the body output and the body input connected by the back edge,
+ * so the output of the previous iteration becomes the input of the next one without a copy.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const MemoryPtr &from, const MemoryPtr &to) : from_mem(from), to_mem(to) {}
+
+    void execute(dnnl::stream strm, int iter = -1) override {
+        if (iter != 0) {
+            auto from_ptr = from_mem->GetData();
+            from_mem->setDataHandle(to_mem->GetData());
+            to_mem->setDataHandle(from_ptr);
+        }
+    }
+
+private:
+    MemoryPtr from_mem;
+    MemoryPtr to_mem;
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MemoryPtr &to, const dnnl::engine& eng) {
@@ -372,6 +470,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_bindable.push_back(isBodyInputBindable(inNode->second));
         }
     }
 
@@ -383,6 +482,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_bindable.push_back(sub_graph.isOutputBindable(outNode->first));
         }
     }
 
@@ -592,6 +692,9 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (!isDynamicNode() && input_bindable[map_rule.to] && isChunkBindable(from_mem, to_mem, map_rule))
+            // the body reads the iteration data directly from the chunk of the input
+            before_mappers.emplace_back(std::make_shared<PortIteratorBindHelper>(from_mem, to_mem, map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
@@ -606,6 +709,9 @@ void TensorIterator::prepareOutputPorts() {
 
         if (map_rule.axis == -1)
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (canBindOutputToChunk(map_rule) && isChunkBindable(to_mem, from_mem, map_rule))
+            // the body writes the iteration result directly into the chunk of the output
+            before_mappers.emplace_back(std::make_shared<PortIteratorBindHelper>(to_mem, from_mem, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
@@ -617,12 +723,55 @@ void TensorIterator::prepareBackEdges() {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mems[map_rule.to].front();
 
-        before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        if (canSwapBackEdge(map_rule))
+            before_mappers.emplace_back(std::make_shared<BackEdgeSwapHelper>(from_mem, to_mem));
+        else
+            before_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
     }
 }
 
+bool TensorIterator::canBindOutputToChunk(const PortMap& map_rule) const {
+    if (!output_bindable[map_rule.to])
+        return false;
+
+    // the back edge copies the output after the chunk of the next iteration is already bound,
+    // and the other concatenations of the same output would share one chunk
+    const auto sameOutput = [&](const PortMap& rule) {
+        return rule.from == map_rule.to;
+    };
+    const auto sameSlicedOutput = [&](const PortMap& rule) {
+        return rule.axis != -1 && rule.to == map_rule.to;
+    };
+    return std::none_of(backEdges.begin(), backEdges.end(), sameOutput) &&
+           std::count_if(outputPortMap.begin(), outputPortMap.end(), sameSlicedOutput) == 1;
+}
+
+bool TensorIterator::canSwapBackEdge(const PortMap& map_rule) const {
+    if (!output_bindable[map_rule.from] || !input_bindable[map_rule.to])
+        return false;
+
+    const auto& from_mem = output_mem[map_rule.from];
+    const auto& to_mem = input_mems[map_rule.to].front();
+    if (!from_mem->getDesc().isDefined() || !to_mem->getDesc().isDefined() ||
+        !from_mem->getDesc().isCompatible(to_mem->getDesc()))
+        return false;
+
+    // the output feeding several back edges would be swapped with all of their inputs
+    const auto sameOutput = [&](const PortMap& rule) {
+        return rule.from == map_rule.from;
+    };
+    return std::count_if(backEdges.begin(), backEdges.end(), sameOutput) == 1;
+}
+
 void TensorIterator::prepareDynamicBackEdges() {
     const auto &eng = getEngine();
+    // the back edges keep their shapes in the most of the loops, so the mappers of the previous iteration stay valid
+    const bool shapesChanged = std::any_of(backEdges.begin(), backEdges.end(), [&](const PortMap& map_rule) {
+        return output_mem[map_rule.from]->GetShape() != input_mems[map_rule.to].front()->GetShape();
+    });
+    if (!shapesChanged && back_mappers.size() == backEdges.size())
+        return;
+
     back_mappers.clear();
     for (auto map_rule : backEdges) {
         auto from_mem = output_mem[map_rule.from];
@@ -126,6 +126,10 @@ private:
     void prepareInitialCond();
     void prepareTripCount();
 
+    /* Zero-copy binding of the body memory */
+    bool canBindOutputToChunk(const PortMap& map_rule) const;
+    bool canSwapBackEdge(const PortMap& map_rule) const;
+
     /* Dynamic support */
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
@@ -136,6 +140,8 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<bool> input_bindable;   /// < The memory of the body input may be redirected to the outer data
+    std::vector<bool> output_bindable;  /// < The memory of the body output may be redirected to the outer data
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -6,6 +6,9 @@
 #include <vector>
 
 #include "unique.hpp"
+#include "common/cpu_memcpy.h"
+#include "common/hash_unique.h"
+#include <ie_parallel.hpp>
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -166,330 +169,61 @@ template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
     const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        std::memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (int j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (int j = 0; j < uniqueLen; j++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (int i = 1; i < inputLen; i++) {
-            bool found = false;
-            int j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
-        }
-    }
+
+    uniqueLen = hashUnique(FlatUniqueKeys<T>{srcDataPtr}, inputLen, sorted, firstUniTmp.data(), inToOutTmp.data(), occurTmp.data());
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
     T* uniDataPtr = reinterpret_cast<T*>(getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetPtr());
-    memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        int *firstPtr = reinterpret_cast<int*>(getChildEdgesAtPort(FIRST_UNIQUE_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        auto inToOutPtr = reinterpret_cast<int*>(getChildEdgesAtPort(INPUT_TO_UNIQ_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        auto occurPtr = reinterpret_cast<int*>(getChildEdgesAtPort(OCCURRENCES_NUM)[0]->getMemoryPtr()->GetPtr());
-        memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
-    }
+    const int32_t* firstTmpPtr = firstUniTmp.data();
+    parallel_for(uniqueLen, [&](size_t u) {
+        uniDataPtr[u] = srcDataPtr[firstTmpPtr[u]];
+    });
+    copyIndicesOutputs(inputLen);
 }
 
 template <typename T>
 void Unique::slicedTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
-    const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
-    }
-
     const auto& srcDataShape = getParentEdgeAt(IN_DATA)->getMemoryPtr()->getStaticDims();
 
     const auto cmpBlNum = srcDataShape[axis]; // Blocks to compare.
-    int64_t partsInBl = 1; // Parts in block
+    size_t partsInBl = 1; // Parts in block
     if (axis > 0) {
         partsInBl = std::accumulate(srcDataShape.begin(), srcDataShape.begin() + axis, 1, std::multiplies<Dim>());
     }
-    int64_t elPerPart = 1; // Elements number in part.
+    size_t elPerPart = 1; // Elements number in part.
     if (axis < srcDataShape.size() - 1) {
         elPerPart = std::accumulate(srcDataShape.begin() + axis + 1, srcDataShape.end(), 1, std::multiplies<Dim>());
     }
-    const auto partLenB = elPerPart * dataPrecision.size();
-    const auto partStep = elPerPart * cmpBlNum;
-
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr[0] = 0;
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr[0] = 0;
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr[0] = 1;
-        std::fill(occurTmpPtr, occurTmpPtr + cmpBlNum, 1);
-    }
-
-    uniqueLen = 1;
-    std::vector<int64_t> uniqIdx(cmpBlNum, 0);
-    for (int b1 = 1; b1 < cmpBlNum; b1++) {
-        auto first1 = srcDataPtr + b1 * elPerPart;
-        auto last1 = srcDataPtr + (b1 + 1) * elPerPart;
-        bool equal = true;
-        int b2 = 0;
-        // Compare with unique blocks.
-        for (; b2 < uniqueLen; b2++) {
-            auto first2 = srcDataPtr + uniqIdx[b2] * elPerPart;
-            equal = true;
-            for (int p = 0; p < partsInBl; p++) {
-                equal = std::equal(first1, last1, first2);
-                if (!equal) {
-                    break;
-                }
-                first1 += partStep;
-                last1  += partStep;
-                first2 += partStep;
-            }
-            if (equal) {
-                break;
-            }
-        }
-        if (!equal) {
-            if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                firstTmpPtr[uniqueLen] = b1;
-            }
-
-            uniqIdx[uniqueLen++] = b1;
-        } else {
-            if (definedOutputs[OCCURRENCES_NUM]) {
-                occurTmpPtr[b2]++;
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[b1] = b2;
-        }
-    }
 
-    const auto dstPrtStep = elPerPart * uniqueLen;
-    for (int b1 = 0; b1 < uniqueLen; b1++) {
-        auto first1 = srcDataPtr + uniqIdx[b1] * elPerPart;
-        auto first2 = uniDataTmpPtr + b1 * elPerPart;
-        for (int p = 0; p < partsInBl; p++) {
-            memcpy(first2, first1, partLenB);
-            first1 += partStep;
-            first2 += dstPrtStep;
-        }
-    }
-
-    if (sorted) {
-        const auto elInBl = elPerPart * partsInBl;
-        struct OrdEl {
-            T val;
-            int64_t idx;
-        };
-
-        std::vector<OrdEl> colToSort(uniqueLen);
-        std::vector<int64_t> moveTo(uniqueLen);
-        for (int k = 0; k < uniqueLen; k++) {
-            moveTo[k] = k;
-        }
-        std::vector<T> buff1(elPerPart);
-        std::vector<T> buff2(elPerPart);
-        for (int64_t p = partsInBl - 1; p >= 0; p--) {
-            for (int64_t e = elPerPart - 1; e >= 0 ; e--) {
-                int64_t pos1 = p * dstPrtStep + e;
-                for (int64_t i = 0; i < uniqueLen; i++) {
-                    int64_t pos2 = i * elInBl + pos1;
-                    colToSort[i] = {uniDataTmpPtr[pos2], i};
-                }
-                std::stable_sort(colToSort.begin(), colToSort.end(), [](const OrdEl &el1, const OrdEl &el2) { return el1.val < el2.val; });
-                for (int k = 0; k < uniqueLen; k++) {
-                    moveTo[colToSort[k].idx] = k;
-                }
-
-                // perm
-                for (int64_t pb = 0; pb < partsInBl; pb++) {
-                    auto currDst = uniDataTmpPtr + pb * dstPrtStep;
-                    memcpy(buff1.data(), currDst, partLenB);
-                    auto dstIdx = moveTo[0];
-                    for (int64_t b = 0; b < uniqueLen; b++) {
-                        if (dstIdx == moveTo[dstIdx]) {
-                            dstIdx = moveTo[++dstIdx];
-                            continue;
-                        }
-                        T* dst = currDst + dstIdx * elPerPart;
-
-                        auto& bSrc = b % 2 == 0 ? buff1 : buff2;
-                        auto& bDst = b % 2 == 0 ? buff2 : buff1;
-                        memcpy(bDst.data(), dst, partLenB);
-                        memcpy(dst, bSrc.data(), partLenB);
-
-                        dstIdx = moveTo[dstIdx];
-                    }
-                }
-
-                auto mPos = moveTo[0];
-                int32_t firstSrc = 0, firstDst = 0, ocSrc = 0, ocDst = 0;
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstSrc = firstTmpPtr[0];
-                }
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    ocSrc = occurTmpPtr[0];
-                }
-                for (int k = 0; k < uniqueLen; k++) {
-                    if (mPos == moveTo[mPos]) {
-                        mPos = moveTo[++mPos];
-                        continue;
-                    }
-
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        auto& fSrc = k % 2 == 0 ? firstSrc : firstDst;
-                        auto& fDst = k % 2 == 0 ? firstDst : firstSrc;
-                        fDst = firstTmpPtr[mPos];
-                        firstTmpPtr[mPos] = fSrc;
-                    }
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        auto& oSrc = k % 2 == 0 ? ocSrc : ocDst;
-                        auto& oDst = k % 2 == 0 ? ocDst : ocSrc;
-                        oDst = occurTmpPtr[mPos];
-                        occurTmpPtr[mPos] = oSrc;
-                    }
-
-                    mPos = moveTo[mPos];
-                }
-            }
-        }
-
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int b1 = 0; b1 < cmpBlNum; b1++) {
-                auto first1 = srcDataPtr + b1 * elPerPart;
-                auto last1 = srcDataPtr + (b1 + 1) * elPerPart;
-                bool equal = true;
-                for (int b2 = 0; b2 < uniqueLen; b2++) {
-                    auto first2 = uniDataTmpPtr + b2 * elPerPart;
-                    equal = true;
-                    for (int p = 0; p < partsInBl; p++) {
-                        equal = std::equal(first1, last1, first2);
-                        if (!equal) {
-                            break;
-                        }
-                        first2 += dstPrtStep;
-                    }
-                    if (equal) {
-                        inToOutTmpPtr[b1] = b2;
-                    }
-                }
-            }
-        }
-    }
+    const SlicedUniqueKeys<T> keys{srcDataPtr, cmpBlNum, partsInBl, elPerPart};
+    uniqueLen = hashUnique(keys, cmpBlNum, sorted, firstUniTmp.data(), inToOutTmp.data(), occurTmp.data());
 
     auto dstDataShape = srcDataShape;
     dstDataShape[axis] = uniqueLen;
     redefineOutputMemory({ dstDataShape, {uniqueLen}, {cmpBlNum}, {uniqueLen}});
 
     T* uniDataPtr = reinterpret_cast<T*>(getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetPtr());
-    memcpy(uniDataPtr, uniDataTmpPtr, getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetSize());
+    const int32_t* firstTmpPtr = firstUniTmp.data();
+    const auto partLenB = elPerPart * sizeof(T);
+    parallel_for2d(partsInBl, uniqueLen, [&](size_t p, size_t u) {
+        cpu_memcpy(uniDataPtr + (p * uniqueLen + u) * elPerPart, srcDataPtr + (p * cmpBlNum + firstTmpPtr[u]) * elPerPart, partLenB);
+    });
+    copyIndicesOutputs(cmpBlNum);
+}
+
+void Unique::copyIndicesOutputs(size_t inputLen) {
     if (definedOutputs[FIRST_UNIQUE_IDX]) {
         int *firstPtr = reinterpret_cast<int*>(getChildEdgesAtPort(FIRST_UNIQUE_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
+        cpu_memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
     }
     if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
         auto inToOutPtr = reinterpret_cast<int*>(getChildEdgesAtPort(INPUT_TO_UNIQ_IDX)[0]->getMemoryPtr()->GetPtr());
-        memcpy(inToOutPtr, inToOutTmp.data(), cmpBlNum * sizeof(int));
+        cpu_memcpy(inToOutPtr, inToOutTmp.data(), inputLen * sizeof(int));
     }
     if (definedOutputs[OCCURRENCES_NUM]) {
         auto occurPtr = reinterpret_cast<int*>(getChildEdgesAtPort(OCCURRENCES_NUM)[0]->getMemoryPtr()->GetPtr());
-        memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
+        cpu_memcpy(occurPtr, occurTmp.data(), uniqueLen * sizeof(int));
     }
 }
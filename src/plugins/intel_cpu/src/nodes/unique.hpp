@@ -35,6 +35,7 @@ private:
     void flattenTensorExec();
     template <typename T>
     void slicedTensorExec();
+    void copyIndicesOutputs(size_t inputLen);
 
     template<typename T>
     struct flattenExec;
@@ -6,17 +6,176 @@
 #include "ie_parallel.hpp"
 #include "nodes/common/cpu_memcpy.h"
 #include "utils/general_utils.h"
+#include "utils/jit_kernel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
 
 namespace ov {
 namespace intel_cpu {
+namespace {
+
+// number of elements of a single channel plane handled by one parallel task
+constexpr size_t normalizeBlockSize = 4096;
+
+struct jit_uni_normalize_kernel : public jit_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_normalize_kernel)
+
+    struct Params {
+        const float * src;
+        float * dst;
+        const float * mean;
+        const float * scale;
+        size_t size;
+    };
+
+    typedef void (*function_t)(const Params *);
+
+    void init() {
+        if (create_kernel() != dnnl::impl::status::success)
+            IE_THROW() << "Can't generate jit normalize kernel";
+        _fn = (function_t)jit_ker();
+    }
+
+    void operator()(const Params & args) const {
+        _fn(&args);
+    }
+
+protected:
+    // broadcast flags mean that a single value is applied to the whole range instead of an array of values
+    jit_uni_normalize_kernel(bool broadcastMean, bool broadcastScale)
+        : jit_kernel(jit_name()),
+          _broadcastMean(broadcastMean),
+          _broadcastScale(broadcastScale) {
+    }
+
+    bool _broadcastMean;
+    bool _broadcastScale;
+    function_t _fn = nullptr;
+};
+
+template<size_t N>
+class JitNormalizeKernel : public jit_uni_normalize_kernel {
+public:
+    JitNormalizeKernel(bool broadcastMean, bool broadcastScale)
+        : jit_uni_normalize_kernel(broadcastMean, broadcastScale) {
+    }
+
+private:
+    void generate() override;
+};
+
+template<size_t N>
+void JitNormalizeKernel<N>::generate() {
+    preamble();
+
+    auto src = arg(&Params::src);
+    auto dst = arg(&Params::dst);
+    auto mean = arg(&Params::mean);
+    auto scale = arg(&Params::scale);
+    auto size = arg(&Params::size);
+
+    auto m = var<float[N]>();
+    auto s = var<float[N]>();
+    auto v = var<float[N]>();
+
+    if (_broadcastMean)
+        uni_vbroadcastss(m, ptr[mean]);
+    if (_broadcastScale)
+        uni_vbroadcastss(s, ptr[scale]);
+
+    const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
+    const size_t step = N * sizeof(float);
+
+    size >>= reg_capacity_log;
+
+    foreach(0, size, [&](const Reg64 & idx) {
+        load(v, src);
+        if (!_broadcastMean) {
+            load(m, mean);
+            mean += step;
+        }
+        if (!_broadcastScale) {
+            load(s, scale);
+            scale += step;
+        }
+        uni_vsubps(v, v, m);    // v = v - mean
+        uni_vmulps(v, v, s);    // v = v * (1 / stdScale)
+        store(dst, v);
+        src += step;
+        dst += step;
+    });
+
+    mov(size, argPtr(&Params::size));
+    size &= N - 1;
+
+    _if(size != 0)
+    ._then([&] {
+        load(v, src, size);
+        if (!_broadcastMean)
+            load(m, mean, size);
+        if (!_broadcastScale)
+            load(s, scale, size);
+        uni_vsubps(v, v, m);
+        uni_vmulps(v, v, s);
+        store(dst, v, size);
+    });
+
+    postamble();
+}
+
+template<bool broadcastMean, bool broadcastScale>
+const jit_uni_normalize_kernel * jit_normalize_kernel_get() {
+    auto createKernel = []() {
+        std::unique_ptr<jit_uni_normalize_kernel> kernel;
+
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            kernel.reset(new JitNormalizeKernel<16>(broadcastMean, broadcastScale));
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            kernel.reset(new JitNormalizeKernel<8>(broadcastMean, broadcastScale));
+        } else if (mayiuse(cpu_isa_t::sse41)) {
+            kernel.reset(new JitNormalizeKernel<4>(broadcastMean, broadcastScale));
+        }
+        if (kernel)
+            kernel->init();
+
+        return kernel;
+    };
+
+    static auto kernel = createKernel();
+
+    return kernel.get();
+}
+
+// dst[i] = (src[i] - mean[i]) * scale[i], where the broadcast mean or scale is a single value
+template<bool broadcastMean, bool broadcastScale>
+void normalize(const float * src, float * dst, const float * mean, const float * scale, size_t size) {
+    static const auto kernel = jit_normalize_kernel_get<broadcastMean, broadcastScale>();
+
+    if (kernel) {
+        jit_uni_normalize_kernel::Params args = { src, dst, mean, scale, size };
+        (*kernel)(args);
+    } else {
+        for (size_t i = 0; i < size; i++) {
+            dst[i] = (src[i] - mean[broadcastMean ? 0 : i]) * scale[broadcastScale ? 0 : i];
+        }
+    }
+}
+
+}   // namespace
 
 NormalizePreprocess::NormalizePreprocess() : meanBuffer(nullptr) {
 }
 
 void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo) {
     PreProcessInfo &pp = inputInfo->getPreProcess();
+    rowMeanValues.clear();
+    rowInvStdScales.clear();
+
     size_t inChannels = pp.getNumberOfChannels();
     if (inChannels == 0) {
         meanBuffer = nullptr;
@@ -32,6 +191,7 @@ void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo
             // mean and standard deviation image common value per channel (1x1xC)
             meanValues.resize(inChannels);
             stdScales.resize(inChannels);
+            invStdScales.resize(inChannels);
 
             for (unsigned channel = 0; channel < inChannels; channel++) {
                 if (pp[channel]->stdScale == 0) {
@@ -39,6 +199,7 @@ void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo
                 }
                 meanValues[channel] = pp[channel]->meanValue;
                 stdScales[channel] = pp[channel]->stdScale;
+                invStdScales[channel] = 1.f / pp[channel]->stdScale;
             }
         }
         break;
@@ -80,7 +241,11 @@ void NormalizePreprocess::Load(const Shape& inputShape, InputInfo::Ptr inputInfo
 }
 
 void NormalizePreprocess::NormalizeImage(const Shape &inputShape, float *input, InferenceEngine::Layout layout) {
-    IE_ASSERT(input != nullptr);
+    NormalizeImage(inputShape, input, input, layout);
+}
+
+void NormalizePreprocess::NormalizeImage(const Shape &inputShape, const float *src, float *dst, InferenceEngine::Layout layout) {
+    IE_ASSERT(src != nullptr && dst != nullptr);
 
     const auto inputDims = inputShape.getStaticDims();
     if (inputDims.size() != 4) {
@@ -91,30 +256,49 @@ void NormalizePreprocess::NormalizeImage(const Shape &inputShape, float *input,
         IE_THROW() << "Expecting input layout NCHW or NHWC.";
     }
 
-    int MB = inputDims[0];
-    int srcSize = inputShape.getElementsCount() / MB;
+    const size_t MB = inputDims[0];
+    const size_t srcSize = inputShape.getElementsCount() / MB;
 
     if (meanBuffer && meanBuffer->size()) {
         const float * meanBufferValues = meanBuffer->readOnly();
+        static const float one = 1.f;
+        const size_t blocks = div_up(srcSize, normalizeBlockSize);
 
-        parallel_for2d(MB, srcSize, [&](int mb, int i) {
-            input[srcSize * mb + i] -= meanBufferValues[i];
+        parallel_for2d(MB, blocks, [&](size_t mb, size_t b) {
+            const size_t offset = b * normalizeBlockSize;
+            const size_t size = std::min(normalizeBlockSize, srcSize - offset);
+            normalize<false, true>(src + mb * srcSize + offset, dst + mb * srcSize + offset,
+                                   meanBufferValues + offset, &one, size);
         });
     } else if (!meanValues.empty() && !stdScales.empty()) {
-        int C = inputDims[1];
-        srcSize /= inputDims[1];
+        const size_t C = inputDims[1];
+        const size_t planeSize = srcSize / C;
 
         if (layout == NCHW) {
-            parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
-                input[mb * C * srcSize + c * srcSize + i] /= stdScales[c];
+            const size_t blocks = div_up(planeSize, normalizeBlockSize);
+
+            parallel_for3d(MB, C, blocks, [&](size_t mb, size_t c, size_t b) {
+                const size_t offset = (mb * C + c) * planeSize + b * normalizeBlockSize;
+                const size_t size = std::min(normalizeBlockSize, planeSize - b * normalizeBlockSize);
+                normalize<true, true>(src + offset, dst + offset, &meanValues[c], &invStdScales[c], size);
             });
         } else if (layout == NHWC) {
-            parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                for (int c = 0; c < C; c++) {
-                    input[mb * srcSize * C + i * C + c] -= meanValues[c];
-                    input[mb * srcSize * C + i * C + c] /= stdScales[c];
+            // channels are interleaved, so the per channel values are replicated along the row
+            // to normalize every row with a single contiguous pass
+            const size_t H = inputDims[2];
+            const size_t rowSize = srcSize / H;
+            if (rowMeanValues.size() != rowSize) {
+                rowMeanValues.resize(rowSize);
+                rowInvStdScales.resize(rowSize);
+                for (size_t i = 0; i < rowSize; i++) {
+                    rowMeanValues[i] = meanValues[i % C];
+                    rowInvStdScales[i] = invStdScales[i % C];
                 }
+            }
+
+            parallel_for2d(MB, H, [&](size_t mb, size_t h) {
+                const size_t offset = (mb * H + h) * rowSize;
+                normalize<false, false>(src + offset, dst + offset, rowMeanValues.data(), rowInvStdScales.data(), rowSize);
             });
         }
     } else {
@@ -21,6 +21,8 @@ public:
 public:
     void Load(const Shape& inputShape, InferenceEngine::InputInfo::Ptr inputInfo);
     void NormalizeImage(const Shape &inputShape, float *input, InferenceEngine::Layout layout);
+    // normalizes src into dst in a single pass, so the separate input copy can be skipped (src may be equal to dst)
+    void NormalizeImage(const Shape &inputShape, const float *src, float *dst, InferenceEngine::Layout layout);
 
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void NormalizeImage(const Shape &inputShape, T *input, InferenceEngine::Layout layout) {
@@ -86,6 +88,13 @@ private:
 
     std::vector<float> stdScales;
 
+    // reciprocals of stdScales, the kernel multiplies instead of dividing
+    std::vector<float> invStdScales;
+
+    // per channel values replicated along the NHWC image row
+    std::vector<float> rowMeanValues;
+    std::vector<float> rowInvStdScales;
+
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
 
@@ -24,6 +24,7 @@
 
 #include "weights_cache.hpp"
 #include "utils/denormals.hpp"
+#include "streams_auto_tuning.h"
 
 #if defined(__linux__)
 # include <sys/auxv.h>
@@ -151,7 +152,7 @@ static bool streamsSet(const std::map<std::string, std::string>& config) {
            config.count(ov::num_streams.name());
 }
 
-void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const {
+std::string Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, const std::shared_ptr<ngraph::Function>& ngraphFunc) const {
     auto getNumStreamsLatency = [&]() {
         return std::pair<std::string, std::string>(CONFIG_VALUE(CPU_THROUGHPUT_NUMA), ov::util::to_string(ov::streams::NUMA));
     };
@@ -264,7 +265,10 @@ void Engine::ApplyPerformanceHints(std::map<std::string, std::string> &config, c
         config[CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL)] =
             std::to_string(tput_hints.second.threads_per_stream_small);
         config[CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET)] = std::to_string(tput_hints.second.small_core_offset);
+    } else {
+        return std::string();
     }
+    return perf_hint_name;
 }
 
 Engine::StreamCfg Engine::GetNumStreams(InferenceEngine::IStreamsExecutor::ThreadBindingType thread_binding_type,
@@ -426,7 +430,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    ApplyPerformanceHints(config, nGraphFunc);
+    const auto perfHintName = ApplyPerformanceHints(config, nGraphFunc);
     transformations.CpuSpecificOpSet();
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "cpu_"));
@@ -452,7 +456,47 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    if (!conf.streamsAutoTuning || perfHintName.empty() || conf.enableDynamicBatch || conf.exclusiveAsyncRequests ||
+        nGraphFunc->is_dynamic()) {
+        return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    }
+
+    const bool latency = perfHintName == CONFIG_VALUE(LATENCY);
+    const int heuristicStreams = latency ? 0 : std::stoi(config[ov::num_streams.name()]);
+    const auto candidates = makeStreamsCandidates(perfHintName, heuristicStreams, getNumberOfCPUCores());
+    auto compile = [&](const StreamsCandidate& candidate) -> IExecutableNetworkInternal::Ptr {
+        Config candidateConf = conf;
+        if (!(candidate == candidates.front())) {
+            auto candidateConfig = config;
+            // the split between the big and the small cores is calculated for the heuristic number of streams only
+            for (const auto& key : {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_KEY_INTERNAL(BIG_CORE_STREAMS),
+                                    CONFIG_KEY_INTERNAL(SMALL_CORE_STREAMS), CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_BIG),
+                                    CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL), CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET)})
+                candidateConfig.erase(key);
+            candidateConfig[ov::num_streams.name()] = ov::util::to_string(ov::streams::Num(candidate.streams));
+            if (candidate.threads > 0)
+                candidateConfig[ov::inference_num_threads.name()] = std::to_string(candidate.threads);
+            candidateConf = engConfig;
+            candidateConf.readProperties(candidateConfig);
+        }
+        auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, candidateConf, extensionManager, shared_from_this());
+        // the inputs info is needed to run the candidate, LoadNetwork sets it to the returned network only
+        execNetwork->setNetworkInputs(clonedNetwork.getInputsInfo());
+        execNetwork->setNetworkOutputs(clonedNetwork.getOutputsInfo());
+        SetExeNetworkInfo(execNetwork, network.getFunction());
+        return execNetwork;
+    };
+    const auto tuned = tuneStreams(candidates, compile, latency);
+
+    // the model cache keeps the tuned values instead of the heuristic ones
+    auto hints_props = nGraphFunc->get_rt_info<ov::AnyMap>("intel_cpu_hints_config");
+    hints_props[perfHintName + "_" + std::string(ov::num_streams.name())] =
+        ov::util::to_string(ov::streams::Num(tuned.candidate.streams));
+    if (tuned.candidate.threads > 0)
+        hints_props[perfHintName + "_" + std::string(ov::inference_num_threads.name())] = std::to_string(tuned.candidate.threads);
+    nGraphFunc->set_rt_info(hints_props, "intel_cpu_hints_config");
+
+    return tuned.network;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -729,6 +773,11 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
             } else {
                 IE_THROW() << "Cache file doesn't contain precalculated number of streams for mode " << mode_name;
             }
+            // the number of threads is saved only if it was chosen by the streams auto-tuning
+            const auto threads = hints_config.find(mode_name + "_" + std::string(ov::inference_num_threads.name()));
+            if (threads != hints_config.end()) {
+                conf.readProperties({{std::string(ov::inference_num_threads.name()), threads->second.as<std::string>()}});
+            }
         }
     }
 
@@ -0,0 +1,137 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_auto_tuning.h"
+
+#include <cpp/ie_infer_request.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <ie_plugin_config.hpp>
+#include "openvino/runtime/properties.hpp"
+#include "utils/debug_capabilities.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+void addCandidate(std::vector<StreamsCandidate>& candidates, const StreamsCandidate& candidate) {
+    if (std::find(candidates.begin(), candidates.end(), candidate) == candidates.end())
+        candidates.push_back(candidate);
+}
+
+void fillInputsByZeros(const IInferRequestInternal::Ptr& request, const ConstInputsDataMap& inputs) {
+    for (const auto& input : inputs) {
+        auto blob = as<MemoryBlob>(request->GetBlob(input.first));
+        if (!blob)
+            continue;
+        auto lock = blob->wmap();
+        std::memset(lock.as<uint8_t*>(), 0, blob->byteSize());
+    }
+}
+
+double measure(const IExecutableNetworkInternal::Ptr& network, bool latency, std::chrono::milliseconds budget) {
+    using clock = std::chrono::steady_clock;
+    size_t requestsNum = 1;
+    if (!latency) {
+        const auto optimalRequests = network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        requestsNum = std::max(1u, optimalRequests);
+    }
+
+    std::vector<IInferRequestInternal::Ptr> requests;
+    for (size_t i = 0; i < requestsNum; i++) {
+        requests.push_back(network->CreateInferRequest());
+        fillInputsByZeros(requests.back(), network->GetInputsInfo());
+    }
+
+    auto runAll = [&requests]() {
+        for (auto& request : requests)
+            request->StartAsync();
+        for (auto& request : requests)
+            request->Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    };
+    // the first inference includes the lazy initialization of the primitives
+    runAll();
+
+    const auto start = clock::now();
+    if (latency) {
+        std::vector<double> latencies;
+        do {
+            const auto inferStart = clock::now();
+            requests.front()->Infer();
+            latencies.push_back(std::chrono::duration<double, std::milli>(clock::now() - inferStart).count());
+        } while (clock::now() - start < budget);
+        auto median = latencies.begin() + latencies.size() / 2;
+        std::nth_element(latencies.begin(), median, latencies.end());
+        return 1.0 / std::max(*median, 1e-6);
+    }
+
+    size_t inferences = 0;
+    do {
+        runAll();
+        inferences += requests.size();
+    } while (clock::now() - start < budget);
+    return inferences / std::chrono::duration<double, std::milli>(clock::now() - start).count();
+}
+
+}   // namespace
+
+std::vector<StreamsCandidate> makeStreamsCandidates(const std::string& perfHint, int heuristicStreams, int cores) {
+    std::vector<StreamsCandidate> candidates;
+    cores = std::max(cores, 1);
+    if (perfHint == CONFIG_VALUE(LATENCY)) {
+        // one stream per NUMA node is the default, a single stream with fewer threads may be faster for the small models
+        addCandidate(candidates, {ov::streams::NUMA, 0});
+        addCandidate(candidates, {1, 0});
+        for (int divisor : {2, 4}) {
+            if (cores / divisor >= 1)
+                addCandidate(candidates, {1, cores / divisor});
+        }
+    } else if (perfHint == CONFIG_VALUE(THROUGHPUT)) {
+        addCandidate(candidates, {std::max(heuristicStreams, 1), 0});
+        for (int divisor : {1, 2, 4, 8}) {
+            if (cores / divisor >= 1)
+                addCandidate(candidates, {cores / divisor, 0});
+        }
+    }
+    return candidates;
+}
+
+StreamsTuningResult tuneStreams(const std::vector<StreamsCandidate>& candidates,
+                                const CompileStreamsCandidate& compile,
+                                bool latency,
+                                std::chrono::milliseconds budget) {
+    if (candidates.empty())
+        IE_THROW() << "There are no streams configurations to tune";
+
+    StreamsTuningResult best{candidates.front(), nullptr};
+    double bestScore = 0.0;
+    for (size_t i = 0; i < candidates.size(); i++) {
+        const auto& candidate = candidates[i];
+        IExecutableNetworkInternal::Ptr network;
+        try {
+            network = compile(candidate);
+        } catch (const InferenceEngine::Exception&) {
+            // the choice of the heuristic has to work, the others are optional
+            if (i == 0)
+                throw;
+            continue;
+        }
+        const double score = measure(network, latency, budget);
+        DEBUG_LOG("Streams auto-tuning: streams=", candidate.streams, " threads=", candidate.threads, " score=", score);
+        if (!best.network || score > bestScore) {
+            // the previous best network is released here, so at most two candidates are alive at once
+            best = {candidate, network};
+            bestScore = score;
+        }
+    }
+    return best;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,60 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+// Auto-tuning of the streams configuration for the performance hints.
+// The static heuristic (MemBandwidthPressureTolerance) knows nothing about many layer types and falls back
+// to the default number of streams for them, so with CPU_STREAMS_AUTO_TUNING the plugin compiles the model
+// with a few configurations around the heuristic choice, runs every one of them for the short time budget
+// and keeps the fastest one. The choice is saved to the model rt_info and reused on import from the model cache.
+
+struct StreamsCandidate {
+    int streams;    // ov::streams::Num value, ov::streams::NUMA is allowed
+    int threads;    // 0 means the default number of threads
+};
+
+inline bool operator==(const StreamsCandidate& lhs, const StreamsCandidate& rhs) {
+    return lhs.streams == rhs.streams && lhs.threads == rhs.threads;
+}
+
+/**
+ * @brief Configurations to check for the performance hint, the first one is the choice of the heuristic.
+ * @param heuristicStreams number of streams chosen by the heuristic, used for THROUGHPUT hint only
+ * @param cores            number of the cores available for the inference
+ */
+std::vector<StreamsCandidate> makeStreamsCandidates(const std::string& perfHint, int heuristicStreams, int cores);
+
+using CompileStreamsCandidate =
+    std::function<InferenceEngine::IExecutableNetworkInternal::Ptr(const StreamsCandidate&)>;
+
+struct StreamsTuningResult {
+    StreamsCandidate candidate;
+    InferenceEngine::IExecutableNetworkInternal::Ptr network;
+};
+
+/**
+ * @brief Compiles and measures the candidates one by one, only the best network is kept alive.
+ * THROUGHPUT hint is scored by the number of inferences per second with the optimal number of requests
+ * running in parallel, LATENCY hint is scored by the median latency of the single request.
+ * The inputs are filled by zeros.
+ * @param budget time of the measurement of every candidate, the warm-up is not included
+ */
+StreamsTuningResult tuneStreams(const std::vector<StreamsCandidate>& candidates,
+                                const CompileStreamsCandidate& compile,
+                                bool latency,
+                                std::chrono::milliseconds budget = std::chrono::milliseconds(300));
+
+}   // namespace intel_cpu
+}   // namespace ov
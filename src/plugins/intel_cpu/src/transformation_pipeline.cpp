@@ -93,6 +93,8 @@
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/mark_embedding_table_decompression.hpp"
+#include "ngraph_transformations/mark_matmul_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -103,6 +105,7 @@
 #include "nodes/normalize.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/mha.h"
+#include "nodes/embedding_bag_sum.h"
 
 #include "dnnl.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
@@ -185,6 +188,10 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     if (useLpt) {
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
     }
+    if (node::EmbeddingBagSum::isTableDecompressionSupported()) {
+        manager.register_pass<MarkEmbeddingTableDecompression>();
+    }
+    manager.register_pass<MarkMatMulWeightsDecompression>();
 
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -616,7 +623,7 @@ void Transformations::MainSnippets(void) {
                                                                    });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called after has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -54,6 +54,9 @@ void DebugCapsConfig::readProperties() {
         summaryPerf = envVarValue;
     }
 
+    if ((envVarValue = readEnv("OV_CPU_HW_COUNTERS")))
+        hwCounters = envVarValue;
+
     if ((envVarValue = readEnv("OV_CPU_DISABLE")))
         disable.parseAndSet(envVarValue);
 
@@ -0,0 +1,247 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#ifdef CPU_DEBUG_CAPS
+
+#include "hw_counters.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+// the bytes moved to or from the memory are estimated by the last level cache misses
+constexpr uint64_t cacheLineSize = 64;
+// the trace keeps the first events only, so a long benchmark does not exhaust the memory
+constexpr size_t maxTraceEvents = 1 << 20;
+
+#if defined(__linux__)
+int openCounter(uint64_t config, int tid, int groupFd) {
+    perf_event_attr attr = {};
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, groupFd, 0));
+}
+
+std::vector<int> getThreadIds() {
+    std::vector<int> tids;
+    DIR* dir = opendir("/proc/self/task");
+    if (!dir)
+        return tids;
+    while (auto entry = readdir(dir)) {
+        if (entry->d_name[0] != '.')
+            tids.push_back(std::atoi(entry->d_name));
+    }
+    closedir(dir);
+    return tids;
+}
+#endif
+
+std::string escapeJson(const std::string& str) {
+    std::string result;
+    for (const auto c : str) {
+        if (c == '"' || c == '\\')
+            result.push_back('\\');
+        result.push_back(c);
+    }
+    return result;
+}
+
+double ipc(const HwCountersSample& counters) {
+    return counters.cycles ? static_cast<double>(counters.instructions) / counters.cycles : 0.0;
+}
+
+}   // namespace
+
+HwCounters& HwCounters::getInstance() {
+    static HwCounters counters;
+    return counters;
+}
+
+HwCounters::HwCounters() {
+#if defined(__linux__)
+    const int fd = openCounter(PERF_COUNT_HW_CPU_CYCLES, 0, -1);
+    available = fd >= 0;
+    if (available)
+        close(fd);
+#endif
+    if (!available)
+        std::cout << "OV_CPU_HW_COUNTERS: perf_event counters are not available, check /proc/sys/kernel/perf_event_paranoid"
+                  << std::endl;
+}
+
+HwCounters::~HwCounters() {
+#if defined(__linux__)
+    for (auto& group : groups) {
+        for (const auto fd : group.second.fds)
+            close(fd);
+    }
+#endif
+}
+
+void HwCounters::updateThreads() {
+#if defined(__linux__)
+    if (!available)
+        return;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto tid : getThreadIds()) {
+        if (groups.count(tid))
+            continue;
+        Group group;
+        group.leader = openCounter(PERF_COUNT_HW_CPU_CYCLES, tid, -1);
+        if (group.leader < 0)
+            continue;
+        group.fds.push_back(group.leader);
+        for (const auto config : {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES}) {
+            const int fd = openCounter(config, tid, group.leader);
+            if (fd >= 0)
+                group.fds.push_back(fd);
+        }
+        // the group is read as a whole, so the partially opened groups are dropped
+        if (group.fds.size() != 3) {
+            for (const auto fd : group.fds)
+                close(fd);
+            continue;
+        }
+        groups.emplace(tid, std::move(group));
+    }
+#endif
+}
+
+void HwCounters::read(HwCountersSample& sample) {
+    sample = {};
+#if defined(__linux__)
+    if (!available)
+        return;
+    struct {
+        uint64_t nr;
+        uint64_t values[3];
+    } data;
+    std::lock_guard<std::mutex> lock(mutex);
+    // the counters of the finished threads keep their final values, so the sums stay monotonic
+    for (const auto& group : groups) {
+        if (::read(group.second.leader, &data, sizeof(data)) != sizeof(data) || data.nr != 3)
+            continue;
+        sample.cycles += data.values[0];
+        sample.instructions += data.values[1];
+        sample.llcMisses += data.values[2];
+    }
+#endif
+}
+
+void HwCountersCollector::startInfer(const std::string& _mode) {
+    mode = _mode;
+    enabled = !mode.empty() && HwCounters::getInstance().isAvailable();
+    if (enabled)
+        HwCounters::getInstance().updateThreads();
+}
+
+void HwCountersCollector::add(Node* node, const HwCountersSample& begin, const HwCountersSample& end,
+                              Clock::time_point start, Clock::time_point finish) {
+    auto index = indices.find(node);
+    if (index == indices.end()) {
+        index = indices.emplace(node, totals.size()).first;
+        totals.emplace_back();
+        totals.back().name = node->getName();
+        totals.back().type = node->getTypeStr() + "_" + node->getPrimitiveDescriptorType();
+    }
+
+    HwCountersSample delta;
+    delta.cycles = end.cycles - begin.cycles;
+    delta.instructions = end.instructions - begin.instructions;
+    delta.llcMisses = end.llcMisses - begin.llcMisses;
+    const auto durationUs = std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+
+    auto& nodeTotals = totals[index->second];
+    nodeTotals.count++;
+    nodeTotals.durationUs += durationUs;
+    nodeTotals.counters.cycles += delta.cycles;
+    nodeTotals.counters.instructions += delta.instructions;
+    nodeTotals.counters.llcMisses += delta.llcMisses;
+
+    if (events.size() < maxTraceEvents) {
+        const auto startUs = std::chrono::duration_cast<std::chrono::microseconds>(start.time_since_epoch()).count();
+        events.push_back({index->second, startUs, durationUs, delta});
+    }
+}
+
+void HwCountersCollector::summary(const std::string& graphName) const {
+    if (totals.empty())
+        return;
+
+    std::vector<const NodeTotals*> sorted;
+    for (const auto& nodeTotals : totals)
+        sorted.push_back(&nodeTotals);
+    std::sort(sorted.begin(), sorted.end(), [](const NodeTotals* a, const NodeTotals* b) {
+        return a->counters.cycles > b->counters.cycles;
+    });
+
+    std::cout << "======= ENABLE_DEBUG_CAPS:OV_CPU_HW_COUNTERS ======" << std::endl;
+    std::cout << "Hardware counters of " << graphName << std::endl;
+    std::cout << std::setw(12) << "avg(us)" << std::setw(16) << "avg cycles" << std::setw(8) << "IPC"
+              << std::setw(14) << "avg bytes" << std::setw(10) << "GB/s" << "  name type" << std::endl;
+    for (const auto nodeTotals : sorted) {
+        const auto count = nodeTotals->count;
+        const auto bytes = nodeTotals->counters.llcMisses * cacheLineSize;
+        const auto bandwidth = nodeTotals->durationUs ? static_cast<double>(bytes) / nodeTotals->durationUs / 1000 : 0.0;
+        std::stringstream ss;
+        ss << std::setw(12) << nodeTotals->durationUs / count
+           << std::setw(16) << nodeTotals->counters.cycles / count
+           << std::setw(8) << std::fixed << std::setprecision(2) << ipc(nodeTotals->counters)
+           << std::setw(14) << bytes / count
+           << std::setw(10) << bandwidth
+           << "  " << nodeTotals->name << " " << nodeTotals->type << std::endl;
+        std::cout << ss.str();
+    }
+
+    const std::string jsonExt = ".json";
+    if (mode.size() > jsonExt.size() && mode.compare(mode.size() - jsonExt.size(), jsonExt.size(), jsonExt) == 0) {
+        // every graph (stream) writes its own trace file
+        const auto graphId = std::hash<const void*>{}(this);
+        writeTrace(mode.substr(0, mode.size() - jsonExt.size()) + "_" + std::to_string(graphId) + jsonExt);
+    }
+}
+
+void HwCountersCollector::writeTrace(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cout << "OV_CPU_HW_COUNTERS: cannot open " << path << std::endl;
+        return;
+    }
+
+    file << "{\"traceEvents\":[";
+    for (size_t i = 0; i < events.size(); i++) {
+        const auto& event = events[i];
+        const auto& nodeTotals = totals[event.node];
+        file << (i ? ",\n" : "\n")
+             << "{\"name\":\"" << escapeJson(nodeTotals.name) << "\",\"cat\":\"" << escapeJson(nodeTotals.type)
+             << "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" << event.startUs << ",\"dur\":" << event.durationUs
+             << ",\"args\":{\"cycles\":" << event.counters.cycles << ",\"instructions\":" << event.counters.instructions
+             << ",\"ipc\":" << ipc(event.counters) << ",\"llc_misses\":" << event.counters.llcMisses
+             << ",\"bytes\":" << event.counters.llcMisses * cacheLineSize << "}}";
+    }
+    file << "\n]}\n";
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
+#endif // CPU_DEBUG_CAPS
@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#ifdef CPU_DEBUG_CAPS
+
+#include <node.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+struct HwCountersSample {
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t llcMisses = 0;
+};
+
+/**
+ * Linux perf_event counters of the whole process. Every thread of the process gets its own group of the counters,
+ * so the work of the parallel regions inside the nodes is counted as well as the work of the calling thread.
+ * The counters of all the streams would be mixed up, so a single stream is forced while the counters are collected
+ * (see Config::applyDebugCapsProperties).
+ */
+class HwCounters {
+public:
+    static HwCounters& getInstance();
+
+    bool isAvailable() const {
+        return available;
+    }
+    // opens the counters for the threads created since the previous call
+    void updateThreads();
+    void read(HwCountersSample& sample);
+
+private:
+    HwCounters();
+    ~HwCounters();
+
+    struct Group {
+        int leader;
+        std::vector<int> fds;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<int, Group> groups;
+    bool available = false;
+};
+
+class HwCountersCollector {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // enables the collection according to the value of OV_CPU_HW_COUNTERS and picks up the new threads
+    void startInfer(const std::string& mode);
+
+    bool isEnabled() const {
+        return enabled;
+    }
+
+    void add(Node* node, const HwCountersSample& begin, const HwCountersSample& end,
+             Clock::time_point start, Clock::time_point finish);
+    // prints the per node summary and writes the Chrome trace if it was requested
+    void summary(const std::string& graphName) const;
+
+private:
+    struct NodeTotals {
+        std::string name;
+        std::string type;
+        uint64_t count = 0;
+        uint64_t durationUs = 0;
+        HwCountersSample counters;
+    };
+    struct Event {
+        size_t node;
+        int64_t startUs;
+        int64_t durationUs;
+        HwCountersSample counters;
+    };
+
+    void writeTrace(const std::string& path) const;
+
+    std::string mode;
+    bool enabled = false;
+    std::vector<NodeTotals> totals;
+    std::unordered_map<const Node*, size_t> indices;
+    std::vector<Event> events;
+};
+
+class HwCountersHelper {
+    HwCountersCollector& collector;
+    const NodePtr& node;
+    HwCountersSample begin;
+    HwCountersCollector::Clock::time_point start;
+
+public:
+    HwCountersHelper(HwCountersCollector& _collector, const NodePtr& _node) : collector(_collector), node(_node) {
+        if (!collector.isEnabled())
+            return;
+        start = HwCountersCollector::Clock::now();
+        HwCounters::getInstance().read(begin);
+    }
+
+    ~HwCountersHelper() {
+        if (!collector.isEnabled())
+            return;
+        HwCountersSample end;
+        HwCounters::getInstance().read(end);
+        collector.add(node.get(), begin, end, start, HwCountersCollector::Clock::now());
+    }
+};
+
+#define HW_COUNTERS(...) HwCountersHelper __hwCountersHelper(__VA_ARGS__);
+}   // namespace intel_cpu
+}   // namespace ov
+#else // CPU_DEBUG_CAPS
+#define HW_COUNTERS(...)
+#endif // CPU_DEBUG_CAPS
@@ -5,12 +5,16 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <common/primitive_hashing_utils.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
+constexpr size_t WeightsSharing::minPurgeThreshold;
 
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -22,7 +26,8 @@ WeightsSharing::SharedMemory::SharedMemory(
 {}
 
 WeightsSharing::SharedMemory::operator MemoryPtr() const {
-    return memory->sharedMemory.lock();
+    // the cached memory may be replaced by the other weights with the colliding key
+    return newPtr;
 }
 
 bool WeightsSharing::SharedMemory::isValid() const {
@@ -37,22 +42,67 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MemoryPtr(void)> create,
                             bool valid) {
+    return findOrCreateImpl(key, std::move(create), valid, nullptr, 0);
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreatePacked(
+                            const std::string& key,
+                            std::function<MemoryPtr(void)> create,
+                            const std::shared_ptr<const void>& source,
+                            size_t sourceSize) {
+    return findOrCreateImpl(key, std::move(create), true, source, sourceSize);
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreateImpl(
+                            const std::string& key,
+                            std::function<MemoryPtr(void)> create,
+                            bool valid,
+                            const std::shared_ptr<const void>& source,
+                            size_t sourceSize) {
+    // the cache lock only finds the entry, the memory is created and compared under the lock of the entry,
+    // so the different weights are created in parallel
     MemoryInfo::Ptr ptr;
-    MemoryPtr newPtr;
     {
         std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+        auto& found = sharedWeights[key];
+        if (!found) {
+            found = std::make_shared<MemoryInfo>(nullptr, valid);
+            if (sharedWeights.size() >= purgeThreshold)
+                purgeExpired();
+        }
+        ptr = found;
+    }
 
-        if (found == sharedWeights.end()
-            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
-            newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+    std::unique_lock<std::mutex> entryLock(ptr->guard);
+    MemoryPtr newPtr = ptr->sharedMemory.lock();
+    if (newPtr && source) {
+        // the hash in the key doesn't prove that the data is the same, the source bytes are compared
+        const auto cachedSource = ptr->source.lock();
+        if (!cachedSource) {
+            // the memory is still used, while its source is released, so the new source is kept to compare with
+            ptr->source = source;
+            ptr->sourceSize = sourceSize;
+        } else if (ptr->sourceSize != sourceSize ||
+                   (cachedSource != source && std::memcmp(cachedSource.get(), source.get(), sourceSize) != 0)) {
+            // the colliding key, the memory is replaced in the cache and stays with its users
+            newPtr = nullptr;
         }
     }
-    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    if (!newPtr) {
+        newPtr = create();
+        {
+            // the memory is also read under the cache lock by get() and footprint()
+            std::unique_lock<std::mutex> lock(guard);
+            ptr->sharedMemory = newPtr;
+        }
+        ptr->valid.store(valid, std::memory_order_relaxed);
+        ptr->source = source;
+        ptr->sourceSize = sourceSize;
+    }
+
+    if (ptr->valid.load(std::memory_order_relaxed))
+        entryLock.unlock();
+    return std::make_shared<SharedMemory>(std::move(entryLock), ptr, newPtr);
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
@@ -71,6 +121,36 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+void WeightsSharing::purgeExpired() {
+    for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+        // the entry may be used by the memory creation, which doesn't hold the cache lock
+        if (it->second->sharedMemory.expired() && it->second.use_count() == 1)
+            it = sharedWeights.erase(it);
+        else
+            ++it;
+    }
+    purgeThreshold = std::max(minPurgeThreshold, 2 * sharedWeights.size());
+}
+
+std::string WeightsSharing::packedWeightsKey(const dnnl::memory::desc& srcDesc, const void* srcData, size_t srcSize,
+                                             const dnnl::memory::desc& dstDesc) {
+    using namespace dnnl::impl::primitive_hashing;
+    const size_t layoutHash = hash_combine(get_md_hash(srcDesc.data), get_md_hash(dstDesc.data));
+    const uint64_t dataHash = simpleCRC.hash(static_cast<const unsigned char*>(srcData), srcSize);
+    return std::to_string(srcSize) + "_" + std::to_string(dataHash) + "_" + std::to_string(layoutHash);
+}
+
+uint64_t WeightsSharing::footprint(std::unordered_set<const void*>& counted) const {
+    uint64_t result = 0;
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& weights : sharedWeights) {
+        const auto memory = weights.second->sharedMemory.lock();
+        if (memory && memory->isAllocated() && counted.insert(memory->GetData()).second)
+            result += memory->GetSize();
+    }
+    return result;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<WeightsSharing>();
@@ -90,5 +170,17 @@ const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     return found->second;
 }
 
+NumaNodesWeights& NumaNodesWeights::packedWeights() {
+    static NumaNodesWeights weights;
+    return weights;
+}
+
+uint64_t NumaNodesWeights::footprint(std::unordered_set<const void*>& counted) const {
+    uint64_t result = 0;
+    for (const auto& cache : _cache_map)
+        result += cache.second->footprint(counted);
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
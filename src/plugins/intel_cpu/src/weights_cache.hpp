@@ -7,6 +7,7 @@
 #include "cpu_memory.h"
 
 #include <unordered_map>
+#include <unordered_set>
 #include <functional>
 #include <string>
 #include <memory>
@@ -57,14 +58,20 @@ class WeightsSharing {
     struct MemoryInfo {
         typedef std::shared_ptr<MemoryInfo> Ptr;
 
-        MemoryInfo(MemoryPtr memoryPtr, bool valid)
+        MemoryInfo(MemoryPtr memoryPtr, bool valid, std::weak_ptr<const void> source = {}, size_t sourceSize = 0)
             : sharedMemory(memoryPtr)
             , valid(valid)
+            , source(std::move(source))
+            , sourceSize(sourceSize)
         {}
 
+        // guards the creation of the memory and the source, the memory is assigned under the cache lock as well
         std::mutex guard;
         std::weak_ptr<Memory> sharedMemory;
         std::atomic<bool> valid;
+        // the data the memory is made of, if the key is the hash of the data
+        std::weak_ptr<const void> source;
+        size_t sourceSize;
     };
 
 public:
@@ -92,13 +99,48 @@ public:
                                    std::function<MemoryPtr(void)> create,
                                    bool valid = true);
 
+    /**
+     * @brief findOrCreate for the key made by packedWeightsKey. The hash in the key may collide, so the cached memory
+     * is reused only if it is made of the same source bytes. The cache doesn't keep the source alive, the cached
+     * memory whose source is released takes the new source. The source must live as long as the users of the memory
+     * do, e.g. the constant input of the node, rather than the temporary data the memory is repacked from.
+     * @param source the source data, the pointer shares the ownership of the object which keeps the data
+     */
+    SharedMemory::Ptr findOrCreatePacked(const std::string& key,
+                                         std::function<MemoryPtr(void)> create,
+                                         const std::shared_ptr<const void>& source,
+                                         size_t sourceSize);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
+    /**
+     * @brief Makes the key of the weights repacked from srcDesc to dstDesc. The key depends on the content and the layouts
+     * only, so it identifies the packed weights in all the compiled models.
+     */
+    static std::string packedWeightsKey(const dnnl::memory::desc& srcDesc, const void* srcData, size_t srcSize,
+                                        const dnnl::memory::desc& dstDesc);
+
+    /**
+     * @brief Returns the size in bytes of the alive cached weights, which are not in the counted set yet,
+     * and adds them to the set
+     */
+    uint64_t footprint(std::unordered_set<const void*>& counted) const;
+
 protected:
+    SharedMemory::Ptr findOrCreateImpl(const std::string& key,
+                                       std::function<MemoryPtr(void)> create,
+                                       bool valid,
+                                       const std::shared_ptr<const void>& source,
+                                       size_t sourceSize);
+    void purgeExpired();
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    // the memory is released by its last user, the entries of the released memory are dropped when the map doubles
+    size_t purgeThreshold = minPurgeThreshold;
+    static constexpr size_t minPurgeThreshold = 64;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -111,9 +153,16 @@ class NumaNodesWeights {
 public:
     NumaNodesWeights();
 
+    /**
+     * @brief The caches of the weights repacked by the nodes, which are shared by all the compiled models of the process
+     */
+    static NumaNodesWeights& packedWeights();
+
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    uint64_t footprint(std::unordered_set<const void*>& counted) const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
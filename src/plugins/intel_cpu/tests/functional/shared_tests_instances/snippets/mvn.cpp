@@ -0,0 +1,37 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/mvn.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+
+namespace {
+
+const std::vector<std::pair<ov::Shape, ov::Shape>> inputShapesPair = {
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{1, 5, 16, 35}, ov::Shape{1, 5, 16, 35}},
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{1, 5, 16, 35}, ov::Shape{1, 5, 1, 35}},
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{1, 5, 16, 35}, ov::Shape{1, 5, 16, 1}},
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{2, 16, 64}, ov::Shape{2, 16, 64}},
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{4, 1, 768}, ov::Shape{4, 1, 768}},
+    std::pair<ov::Shape, ov::Shape>{ov::Shape{1, 5, 16, 1}, ov::Shape{1, 5, 16, 1}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_AddMVN, AddMVN,
+                     ::testing::Combine(
+                             ::testing::ValuesIn(inputShapesPair),
+                             ::testing::Bool(),
+                             ::testing::Values(ov::op::MVNEpsMode::INSIDE_SQRT, ov::op::MVNEpsMode::OUTSIDE_SQRT),
+                             ::testing::Values(1),
+                             ::testing::Values(1),
+                             ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                     AddMVN::getTestCaseName);
+
+} // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
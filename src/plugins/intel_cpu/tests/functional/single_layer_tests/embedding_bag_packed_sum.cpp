@@ -67,7 +67,10 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the f32 table is accumulated by the JIT kernel
+        const bool isJit = inType == ElementType::f32 && InferenceEngine::with_cpu_x86_avx2();
+        const auto implType = isJit ? (InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2") : "ref";
+        selectedType = makeSelectedTypeStr(implType, inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
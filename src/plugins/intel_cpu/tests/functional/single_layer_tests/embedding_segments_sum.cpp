@@ -77,7 +77,10 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // the f32 table is accumulated by the JIT kernel
+        const bool isJit = inType == ElementType::f32 && InferenceEngine::with_cpu_x86_avx2();
+        const auto implType = isJit ? (InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2") : "ref";
+        selectedType = makeSelectedTypeStr(implType, inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
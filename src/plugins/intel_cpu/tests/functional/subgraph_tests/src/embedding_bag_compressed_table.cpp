@@ -0,0 +1,94 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+enum class TableScale { NONE, COMMON, PER_ROW };
+
+using EmbeddingBagCompressedTableParams = std::tuple<ngraph::element::Type,   // table precision
+                                                     TableScale>;
+
+/* The compressed embedding table is dequantized by EmbeddingBag on the fly,
+ * Convert and Multiply are fused into the node.
+
+    Table[I8/U8]
+         |
+      Convert
+         |
+    Multiply(scale)   Indices
+            \         /
+      EmbeddingBagPackedSum
+               |
+             Output
+*/
+class EmbeddingBagCompressedTableTest : public testing::WithParamInterface<EmbeddingBagCompressedTableParams>,
+                                        virtual public LayerTestsUtils::LayerTestsCommon,
+                                        public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<EmbeddingBagCompressedTableParams> obj) {
+        ngraph::element::Type tablePrecision;
+        TableScale scale;
+        std::tie(tablePrecision, scale) = obj.param;
+        std::ostringstream result;
+        result << "table=" << tablePrecision << "_scale="
+               << (scale == TableScale::NONE ? "none" : scale == TableScale::COMMON ? "common" : "perRow");
+        return result.str();
+    }
+
+protected:
+    Blob::Ptr GenerateInput(const InputInfo& info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), rows, 0);
+    }
+
+    void SetUp() override {
+        ngraph::element::Type tablePrecision;
+        TableScale scale;
+        std::tie(tablePrecision, scale) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t dim = 35, batch = 4, bagSize = 6;
+        auto params = ngraph::builder::makeParams(ngraph::element::i32, {{batch, bagSize}});
+
+        const int8_t tableMin = tablePrecision == ngraph::element::i8 ? -100 : 0;
+        std::shared_ptr<ngraph::Node> table = ngraph::builder::makeConstant<int8_t>(tablePrecision, {rows, dim}, {}, true, 100, tableMin);
+        table = std::make_shared<ngraph::opset1::Convert>(table, ngraph::element::f32);
+        if (scale == TableScale::COMMON) {
+            auto scaleConst = ngraph::builder::makeConstant<float>(ngraph::element::f32, {}, {0.05f});
+            table = std::make_shared<ngraph::opset1::Multiply>(table, scaleConst);
+        } else if (scale == TableScale::PER_ROW) {
+            auto scaleConst = ngraph::builder::makeConstant<float>(ngraph::element::f32, {rows, 1}, {}, true, 0.1f, 0.01f);
+            table = std::make_shared<ngraph::opset1::Multiply>(table, scaleConst);
+        }
+
+        auto embeddingBag = std::make_shared<ngraph::opset3::EmbeddingBagPackedSum>(table, params[0]);
+        function = makeNgraphFunction(ngraph::element::f32, params, embeddingBag, "EmbeddingBagCompressedTable");
+    }
+
+    const size_t rows = 50;
+};
+
+TEST_P(EmbeddingBagCompressedTableTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+        CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagCompressedTable, EmbeddingBagCompressedTableTest,
+                         ::testing::Combine(::testing::Values(ngraph::element::i8, ngraph::element::u8),
+                                            ::testing::Values(TableScale::NONE, TableScale::COMMON, TableScale::PER_ROW)),
+                         EmbeddingBagCompressedTableTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
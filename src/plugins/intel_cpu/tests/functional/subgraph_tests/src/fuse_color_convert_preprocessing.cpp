@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/nv12_to_bgr.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FuseColorConvertPreprocessingParams = std::tuple<bool,   // RGB (true) or BGR (false) output
+                                                       bool>;  // single plane NV12 input
+
+/* The preprocessing chain of the camera image lowered by PrePostProcessor.
+ * The Converts are merged into ColorConvert and the per channel mean/scale is fused into it.
+
+    Y[U8]        UV[U8]
+      |            |
+   Convert      Convert
+      \          /
+     NV12toRGB[FP32]
+           |
+     Subtract(mean)
+           |
+     Multiply(1/std)
+           |
+        Output
+*/
+class FuseColorConvertPreprocessingTest : public testing::WithParamInterface<FuseColorConvertPreprocessingParams>,
+                                          virtual public LayerTestsUtils::LayerTestsCommon,
+                                          public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FuseColorConvertPreprocessingParams> obj) {
+        bool isRGB, singlePlane;
+        std::tie(isRGB, singlePlane) = obj.param;
+        std::ostringstream result;
+        result << (isRGB ? "RGB" : "BGR") << "_" << (singlePlane ? "SinglePlane" : "TwoPlanes");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        bool isRGB, singlePlane;
+        std::tie(isRGB, singlePlane) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t height = 32, width = 48;
+        ngraph::ParameterVector params;
+        ngraph::OutputVector planes;
+        if (singlePlane) {
+            params = ngraph::builder::makeParams(ngraph::element::u8, {{1, height * 3 / 2, width, 1}});
+        } else {
+            params = ngraph::builder::makeParams(ngraph::element::u8, {{1, height, width, 1}, {1, height / 2, width / 2, 2}});
+        }
+        for (auto & param : params) {
+            planes.push_back(std::make_shared<ngraph::opset1::Convert>(param, ngraph::element::f32));
+        }
+
+        std::shared_ptr<ngraph::Node> convertColor;
+        if (isRGB) {
+            convertColor = singlePlane ? std::make_shared<ov::op::v8::NV12toRGB>(planes[0])
+                                       : std::make_shared<ov::op::v8::NV12toRGB>(planes[0], planes[1]);
+        } else {
+            convertColor = singlePlane ? std::make_shared<ov::op::v8::NV12toBGR>(planes[0])
+                                       : std::make_shared<ov::op::v8::NV12toBGR>(planes[0], planes[1]);
+        }
+
+        auto mean = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 1, 1, 3}, {123.675f, 116.28f, 103.53f});
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convertColor, mean);
+        auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1, 1, 1, 3}, {0.0171f, 0.0175f, 0.0174f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+
+        function = makeNgraphFunction(ngraph::element::f32, params, multiply, "FuseColorConvertPreprocessing");
+    }
+};
+
+TEST_P(FuseColorConvertPreprocessingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    CheckNumberOfNodesWithType(executableNetwork, "ColorConvert", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FuseColorConvertPreprocessing, FuseColorConvertPreprocessingTest,
+                         ::testing::Combine(::testing::Bool(), ::testing::Bool()),
+                         FuseColorConvertPreprocessingTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,88 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <exec_graph_info.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The convolutions are forced to the blocked layout. The greedy selection keeps the planar layout of the input
+ * for Relu, because it looks at the parents only, then every convolution gets its own reorder to the blocked layout.
+ * The layout assignment switches Relu to the blocked layout of the convolutions, so the only reorder before them
+ * is the one after the input, i.e. exactly one reorder is eliminated.
+
+              Input
+                |
+             Reorder
+                |
+              Relu
+             /     \
+    Convolution   Convolution
+         |             |
+      Reorder       Reorder
+         |             |
+      Output        Output
+*/
+class LayoutAssignmentTest : virtual public LayerTestsUtils::LayerTestsCommon,
+                             public CPUTestsBase {
+protected:
+    static size_t countReorders(InferenceEngine::ExecutableNetwork& execNet) {
+        size_t count = 0;
+        for (const auto& node : execNet.GetExecGraphInfo().getFunction()->get_ops()) {
+            if (node->get_rt_info().at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() == "Reorder")
+                count++;
+        }
+        return count;
+    }
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // Relu is not wrapped into a subgraph, which has its own layouts
+        configuration[PluginConfigInternalParams::KEY_SNIPPETS_MODE] = PluginConfigInternalParams::DISABLE;
+        // the blocked layout of the convolutions and the eltwise nodes on the current ISA
+        const auto blockedFormat = with_cpu_x86_avx512_core() ? nChw16c : nChw8c;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 32, 16, 16}});
+        auto relu = std::make_shared<ngraph::opset1::Relu>(params[0]);
+        ngraph::ResultVector results;
+        for (size_t i = 0; i < 2; i++) {
+            auto conv = ngraph::builder::makeConvolution(relu, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ngraph::op::PadType::EXPLICIT, 32);
+            conv->get_rt_info() = makeCPUInfo({blockedFormat}, {blockedFormat}, {});
+            results.push_back(std::make_shared<ngraph::opset1::Result>(conv));
+        }
+        function = std::make_shared<ngraph::Function>(results, params, "LayoutAssignment");
+    }
+};
+
+TEST_F(LayoutAssignmentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT] = PluginConfigParams::YES;
+    Run();
+    const auto reorders = countReorders(executableNetwork);
+
+    auto greedyConfiguration = configuration;
+    greedyConfiguration[PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT] = PluginConfigParams::NO;
+    auto greedyNetwork = core->LoadNetwork(cnnNetwork, targetDevice, greedyConfiguration);
+    EXPECT_EQ(reorders + 1, countReorders(greedyNetwork));
+
+    using Report = std::map<std::string, uint64_t>;
+    const auto report = executableNetwork.GetMetric(ov::intel_cpu::layout_assignment_report.name()).as<Report>();
+    EXPECT_EQ(report.at("reorders_eliminated"), 1);
+    EXPECT_EQ(report.at("reorders_before"), report.at("reorders_after") + 1);
+    EXPECT_EQ(report.at("changed_nodes"), 1);
+
+    const auto greedyReport = greedyNetwork.GetMetric(ov::intel_cpu::layout_assignment_report.name()).as<Report>();
+    EXPECT_EQ(greedyReport.at("reorders_eliminated"), 0);
+}
+
+}  // namespace SubgraphTestsDefinitions
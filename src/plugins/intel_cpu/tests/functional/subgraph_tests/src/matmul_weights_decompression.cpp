@@ -0,0 +1,149 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MatMulWeightsDecompressionParams = std::tuple<ngraph::element::Type,   // weights precision
+                                                    bool,                    // with zero points
+                                                    size_t,                  // groups number
+                                                    ngraph::Shape,           // activations shape
+                                                    bool>;                   // with activation
+
+/* The compressed weights are dequantized by FullyConnected inside of the kernel,
+ * Convert, Subtract and Multiply are fused into the node.
+ * The large batches are run by oneDNN primitive with the decompressed weights, which fuses the activation.
+
+    Weights[I8/U8/U4]
+          |
+       Convert
+          |
+    Subtract(zero point, optional)
+          |
+    Multiply(scale)
+          |
+    Reshape(grouped weights only)   Input
+                 \                  /
+                  MatMul(transpose_b)
+                          |
+                    Relu(optional)
+                          |
+                        Output
+
+    The weights are constant folded when FullyConnected can't dequantize them, e.g. for 4D activations.
+*/
+class MatMulWeightsDecompressionTest : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                       virtual public LayerTestsUtils::LayerTestsCommon,
+                                       public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        ngraph::element::Type weightsPrecision;
+        bool withZeroPoints;
+        size_t groupsNum;
+        ngraph::Shape activationsShape;
+        bool withActivation;
+        std::tie(weightsPrecision, withZeroPoints, groupsNum, activationsShape, withActivation) = obj.param;
+        std::ostringstream result;
+        result << "weights=" << weightsPrecision << (withZeroPoints ? "_withZP" : "_noZP") << "_groups=" << groupsNum
+               << "_IS=" << CommonTestUtils::vec2str(activationsShape) << (withActivation ? "_Relu" : "");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ngraph::element::Type weightsPrecision;
+        bool withZeroPoints;
+        size_t groupsNum;
+        ngraph::Shape activationsShape;
+        bool withActivation;
+        std::tie(weightsPrecision, withZeroPoints, groupsNum, activationsShape, withActivation) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t N = 48, K = activationsShape.back(), groupSize = K / groupsNum;
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {activationsShape});
+
+        const ngraph::Shape weightsShape = groupsNum == 1 ? ngraph::Shape{N, K} : ngraph::Shape{N, groupsNum, groupSize};
+        const ngraph::Shape paramShape = groupsNum == 1 ? ngraph::Shape{N, 1} : ngraph::Shape{N, groupsNum, 1};
+        std::shared_ptr<ngraph::Node> weights;
+        if (weightsPrecision == ngraph::element::u4) {
+            // makeConstant does not support the low precisions
+            const auto values = NGraphFunctions::Utils::generateVector<ngraph::element::Type_t::u8>(ngraph::shape_size(weightsShape), 15, 0);
+            weights = std::make_shared<ngraph::opset1::Constant>(weightsPrecision, weightsShape, values);
+        } else {
+            const int8_t weightsMin = weightsPrecision == ngraph::element::i8 ? -100 : 0;
+            weights = ngraph::builder::makeConstant<int8_t>(weightsPrecision, weightsShape, {}, true, 100, weightsMin);
+        }
+        weights = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        if (withZeroPoints) {
+            auto zeroPoints = ngraph::builder::makeConstant<float>(ngraph::element::f32, paramShape, {}, true, 8.f, 0.f);
+            weights = std::make_shared<ngraph::opset1::Subtract>(weights, zeroPoints);
+        }
+        auto scales = ngraph::builder::makeConstant<float>(ngraph::element::f32, paramShape, {}, true, 0.05f, 0.001f);
+        weights = std::make_shared<ngraph::opset1::Multiply>(weights, scales);
+        if (groupsNum != 1) {
+            auto shape = ngraph::opset1::Constant::create(ngraph::element::i64, {2}, {N, K});
+            weights = std::make_shared<ngraph::opset1::Reshape>(weights, shape, false);
+        }
+
+        std::shared_ptr<ngraph::Node> result = std::make_shared<ngraph::opset1::MatMul>(params[0], weights, false, true);
+        if (withActivation)
+            result = std::make_shared<ngraph::opset1::Relu>(result);
+        function = makeNgraphFunction(ngraph::element::f32, params, result, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the decompression is either fused into FullyConnected or constant folded, it is never executed as is
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    const auto& activationsShape = std::get<3>(GetParam());
+    const bool fullyConnected = activationsShape.size() != 4;
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", fullyConnected ? 1 : 0);
+    CheckNumberOfNodesWithType(executableNetwork, "MatMul", fullyConnected ? 0 : 1);
+
+    // the dequantizing kernel runs up to 16 rows and has no post ops, the larger batches fuse the activation
+    const size_t M = ngraph::shape_size(activationsShape) / activationsShape.back();
+    const bool dequantizingKernel = fullyConnected && M < 16;
+    const bool withActivation = std::get<4>(GetParam());
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", withActivation && dequantizingKernel ? 1 : 0);
+    if (fullyConnected) {
+        for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            if (rtInfo.at(ExecGraphInfoSerialization::LAYER_TYPE).as<std::string>() != "FullyConnected")
+                continue;
+            const auto implType = rtInfo.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+            if (dequantizingKernel)
+                ASSERT_EQ(implType.find("ref"), 0u) << implType;
+            else
+                ASSERT_NE(implType.find("ref"), 0u) << implType;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression, MatMulWeightsDecompressionTest,
+                         ::testing::Combine(::testing::Values(ngraph::element::u8, ngraph::element::i8, ngraph::element::u4),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1, 4),
+                                            ::testing::Values(ngraph::Shape{1, 5, 64}, ngraph::Shape{2, 20, 64}),
+                                            ::testing::Bool()),
+                         MatMulWeightsDecompressionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_4D, MatMulWeightsDecompressionTest,
+                         ::testing::Combine(::testing::Values(ngraph::element::u8),
+                                            ::testing::Bool(),
+                                            ::testing::Values(1),
+                                            ::testing::Values(ngraph::Shape{2, 3, 5, 64}),
+                                            ::testing::Values(false)),
+                         MatMulWeightsDecompressionTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+/* The activations dominate the footprint of the model, so every additional stream adds about the same memory
+ * as the single stream needs, while the weights are small.
+
+          Input
+            |
+       Convolution
+            |
+       Convolution
+            |
+          Result
+*/
+class MemoryBudgetTest : public ::testing::Test {
+protected:
+    static constexpr size_t channels = 16;
+    static constexpr size_t spatial = 128;
+    static constexpr size_t kernel = 3;
+
+    static std::shared_ptr<ov::Model> makeModel() {
+        auto params = ngraph::builder::makeParams(ov::element::f32, {{1, channels, spatial, spatial}});
+        std::shared_ptr<ov::Node> node = params[0];
+        for (size_t i = 0; i < 2; i++) {
+            node = ngraph::builder::makeConvolution(node, ov::element::f32, {kernel, kernel}, {1, 1}, {1, 1}, {1, 1},
+                                                    {1, 1}, ov::op::PadType::EXPLICIT, channels);
+        }
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(node)}, params,
+                                           "MemoryBudget");
+    }
+
+    static std::map<std::string, uint64_t> footprint(const ov::CompiledModel& compiledModel) {
+        return compiledModel.get_property(ov::intel_cpu::memory_footprint);
+    }
+
+    ov::Core core;
+    std::shared_ptr<ov::Model> model = makeModel();
+};
+
+TEST_F(MemoryBudgetTest, smoke_FootprintMatchesGraphAndWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(1));
+    const auto single = footprint(compiledModel);
+    ASSERT_EQ(single.at("streams"), 1);
+    ASSERT_GT(single.at("total"), 0);
+    EXPECT_EQ(single.at("total"), single.at("shared_weights") + single.at("stream_weights") +
+                                  single.at("activations") + single.at("scratchpads"));
+
+    // the weights of both convolutions and the tensor between them
+    const uint64_t weightsSize = 2 * channels * channels * kernel * kernel * sizeof(float);
+    const uint64_t intermediateSize = channels * spatial * spatial * sizeof(float);
+    EXPECT_GE(single.at("shared_weights") + single.at("stream_weights"), weightsSize);
+    EXPECT_GE(single.at("activations"), intermediateSize);
+
+    // every stream has its own activations
+    const auto twoStreams = footprint(core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(2)));
+    ASSERT_EQ(twoStreams.at("streams"), 2);
+    EXPECT_EQ(twoStreams.at("activations"), 2 * single.at("activations"));
+}
+
+TEST_F(MemoryBudgetTest, smoke_BudgetReducesStreams) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto single = footprint(core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(1)));
+    // enough for a single stream, but not for two of them
+    const auto budget = single.at("total") + single.at("total") / 2;
+
+    const auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                                  ov::num_streams(4), ov::intel_cpu::memory_budget(budget));
+    const int32_t streams = compiledModel.get_property(ov::num_streams);
+    EXPECT_EQ(streams, 1);
+    const auto fitted = footprint(compiledModel);
+    EXPECT_EQ(fitted.at("streams"), 1);
+    EXPECT_LE(fitted.at("total"), budget);
+}
+
+TEST_F(MemoryBudgetTest, smoke_BudgetCanNotBeMet) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto single = footprint(core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(1)));
+    EXPECT_THROW(core.compile_model(model, CommonTestUtils::DEVICE_CPU,
+                                    ov::num_streams(4), ov::intel_cpu::memory_budget(single.at("total") / 2)),
+                 ov::Exception);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ie_plugin_config.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+/* The first output is produced by the in-place Reshape, so the memory of the output is shared with the convolution
+ * output. The user output blob has to replace the whole shared memory, so the convolution writes the result directly
+ * into it and the output is not copied at the end of the inference.
+ * The second output is the graph input, which keeps its own data, so it is copied to the user output blob.
+
+              Input
+             /     \
+      Convolution   \
+            |        \
+         Reshape      \
+            |          \
+      ZeroCopyOutput  CopiedOutput
+*/
+class OutputZeroCopyTest : virtual public LayerTestsUtils::LayerTestsCommon,
+                           public CPUTestsBase {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, {{1, 8, 16, 16}});
+        auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, 8);
+        auto shape = ngraph::opset1::Constant::create(ngraph::element::i64, {2}, std::vector<int64_t>{8, 256});
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(conv, shape, false);
+        auto zeroCopyOutput = std::make_shared<ngraph::opset1::Result>(reshape);
+        zeroCopyOutput->set_friendly_name("ZeroCopyOutput");
+        auto copiedOutput = std::make_shared<ngraph::opset1::Result>(params[0]);
+        copiedOutput->set_friendly_name("CopiedOutput");
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{zeroCopyOutput, copiedOutput}, params,
+                                                      "OutputZeroCopy");
+    }
+};
+
+TEST_F(OutputZeroCopyTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the user blobs become the output memory of the graph
+    std::map<std::string, Blob::Ptr> userOutputs;
+    for (const auto& output : executableNetwork.GetOutputsInfo()) {
+        auto blob = FuncTestUtils::createAndFillBlob(output.second->getTensorDesc());
+        inferRequest.SetBlob(output.first, blob);
+        userOutputs[output.first] = blob;
+    }
+    inferRequest.Infer();
+    for (const auto& output : userOutputs)
+        ASSERT_EQ(inferRequest.GetBlob(output.first)->buffer().as<void*>(), output.second->buffer().as<void*>());
+
+    // the copy counter of the output tells if the graph has written the output to the user blob in place
+    const auto counters = inferRequest.GetPerformanceCounts();
+    const auto zeroCopy = counters.find("ZeroCopyOutput_copy");
+    ASSERT_NE(zeroCopy, counters.end());
+    EXPECT_STREQ(zeroCopy->second.exec_type, "zero_copy");
+    EXPECT_STREQ(zeroCopy->second.layer_type, "OutputCopy");
+
+    const auto copied = counters.find("CopiedOutput_copy");
+    ASSERT_NE(copied, counters.end());
+    const auto copiedBytes = 1 * 8 * 16 * 16 * sizeof(float);
+    EXPECT_EQ(std::string(copied->second.exec_type), "copy_" + std::to_string(copiedBytes) + "_bytes");
+    EXPECT_EQ(copied->second.status, InferenceEngineProfileInfo::EXECUTED);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,58 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+/* The weights of GRUCell are repacked into the internal blobs of the RNN node, the blobs are released after
+ * the graph is initialized. The repacked weights are shared by all the streams, so the streams don't add
+ * the weights to the memory footprint.
+
+        X        H
+         \      /
+         GRUCell(W, R, B)
+            |
+          Result
+*/
+class PackedWeightsSharingTest : public ::testing::Test {
+protected:
+    static constexpr size_t batch = 2;
+    static constexpr size_t inputSize = 64;
+    static constexpr size_t hiddenSize = 128;
+
+    static std::shared_ptr<ov::Model> makeModel() {
+        auto params = ngraph::builder::makeParams(ov::element::f32, {{batch, inputSize}, {batch, hiddenSize}});
+        const std::vector<ov::Shape> WRB = {{3 * hiddenSize, inputSize}, {3 * hiddenSize, hiddenSize}, {3 * hiddenSize}};
+        auto gruCell = ngraph::builder::makeGRU(ov::OutputVector{params[0], params[1]}, WRB, hiddenSize);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(gruCell)}, params,
+                                           "PackedWeightsSharing");
+    }
+
+    // the weights shared by the streams and the ones owned by them
+    static uint64_t weightsFootprint(const ov::CompiledModel& compiledModel, size_t streams) {
+        const auto footprint = compiledModel.get_property(ov::intel_cpu::memory_footprint);
+        EXPECT_EQ(footprint.at("streams"), streams);
+        return footprint.at("shared_weights") + footprint.at("stream_weights");
+    }
+};
+
+TEST_F(PackedWeightsSharingTest, smoke_StreamsShareRepackedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    const auto model = makeModel();
+    const auto singleStream = core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(1));
+    const auto weights = weightsFootprint(singleStream, 1);
+    ASSERT_GT(weights, 0);
+
+    // every stream would add its own copy of the repacked weights otherwise
+    const auto multiStream = core.compile_model(model, CommonTestUtils::DEVICE_CPU, ov::num_streams(4));
+    EXPECT_EQ(weightsFootprint(multiStream, 4), weights);
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,171 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+/* The hidden and the cell states of LSTMSequence are read from the variables and written back to them only,
+ * so the RNN node keeps the states resident in the stores of the variables. The results are compared with
+ * the same model, which takes the states as the inputs and returns them as the outputs.
+
+        X      ReadValue(H)  ReadValue(C)
+         \          |           /
+               LSTMSequence
+         /          |           \
+      Result    Assign(H)    Assign(C)
+*/
+class RNNResidentStateTest : public ::testing::Test {
+protected:
+    static constexpr size_t batch = 1;
+    static constexpr size_t seqLength = 3;
+    static constexpr size_t inputSize = 8;
+    static constexpr size_t hiddenSize = 16;
+    const std::vector<std::string> stateNames{"H", "C"};
+
+    std::shared_ptr<ov::Model> makeModel(bool stateful) const {
+        const auto prc = ov::element::f32;
+        const ov::Shape stateShape{batch, 1, hiddenSize};
+        ov::ParameterVector params{std::make_shared<ov::opset6::Parameter>(prc, ov::Shape{batch, seqLength, inputSize})};
+        std::vector<std::shared_ptr<ov::op::util::Variable>> variables;
+        ov::OutputVector initStates;
+        for (const auto& name : stateNames) {
+            if (stateful) {
+                auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{stateShape, prc, name});
+                auto init = ov::opset6::Constant::create(prc, stateShape, {0.f});
+                initStates.push_back(std::make_shared<ov::opset6::ReadValue>(init, variable));
+                variables.push_back(variable);
+            } else {
+                params.push_back(std::make_shared<ov::opset6::Parameter>(prc, stateShape));
+                initStates.push_back(params.back());
+            }
+        }
+
+        auto seqLengths = ov::opset6::Constant::create(ov::element::i32, {batch}, {seqLength});
+        auto W = ngraph::builder::makeConstant<float>(prc, {1, 4 * hiddenSize, inputSize}, {}, true, 0.5f, -0.5f, 1);
+        auto R = ngraph::builder::makeConstant<float>(prc, {1, 4 * hiddenSize, hiddenSize}, {}, true, 0.5f, -0.5f, 2);
+        auto B = ngraph::builder::makeConstant<float>(prc, {1, 4 * hiddenSize}, {}, true, 0.5f, -0.5f, 3);
+        auto lstm = std::make_shared<ov::opset6::LSTMSequence>(params[0], initStates[0], initStates[1], seqLengths, W, R, B,
+                                                               hiddenSize, ov::op::RecurrentSequenceDirection::FORWARD);
+
+        ov::ResultVector results{std::make_shared<ov::opset6::Result>(lstm->output(0))};
+        ov::SinkVector assigns;
+        for (size_t s = 0; s < stateNames.size(); s++) {
+            if (stateful)
+                assigns.push_back(std::make_shared<ov::opset6::Assign>(lstm->output(s + 1), variables[s]));
+            else
+                results.push_back(std::make_shared<ov::opset6::Result>(lstm->output(s + 1)));
+        }
+        return std::make_shared<ov::Model>(results, assigns, params, "RNNResidentState");
+    }
+
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        compiledModel = core.compile_model(makeModel(true), CommonTestUtils::DEVICE_CPU);
+        reference = core.compile_model(makeModel(false), CommonTestUtils::DEVICE_CPU).create_infer_request();
+    }
+
+    static ov::Tensor copy(const ov::Tensor& tensor) {
+        ov::Tensor result(tensor.get_element_type(), tensor.get_shape());
+        std::memcpy(result.data(), tensor.data(), tensor.get_byte_size());
+        return result;
+    }
+
+    std::vector<ov::Tensor> initialStates() const {
+        std::vector<ov::Tensor> states;
+        for (size_t s = 0; s < stateNames.size(); s++) {
+            ov::Tensor state(ov::element::f32, {batch, 1, hiddenSize});
+            std::memset(state.data(), 0, state.get_byte_size());
+            states.push_back(state);
+        }
+        return states;
+    }
+
+    ov::VariableState getState(ov::InferRequest& request, const std::string& name) const {
+        for (auto& state : request.query_state()) {
+            if (state.get_name() == name)
+                return state;
+        }
+        throw std::runtime_error("The variable " + name + " is not found");
+    }
+
+    // infers the stateful request and the reference with the same input, the reference states are updated
+    void inferAndCompare(ov::InferRequest& request, std::vector<ov::Tensor>& states, int seed) {
+        const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, {batch, seqLength, inputSize}, 2, -1, 100, seed);
+        request.set_input_tensor(input);
+        request.infer();
+
+        reference.set_input_tensor(0, input);
+        for (size_t s = 0; s < states.size(); s++)
+            reference.set_input_tensor(s + 1, states[s]);
+        reference.infer();
+
+        ov::test::utils::compare(reference.get_output_tensor(0), request.get_output_tensor(0), 1e-5, 1e-5);
+        for (size_t s = 0; s < states.size(); s++) {
+            states[s] = copy(reference.get_output_tensor(s + 1));
+            ov::test::utils::compare(states[s], getState(request, stateNames[s]).get_state(), 1e-5, 1e-5);
+        }
+    }
+
+    ov::Core core;
+    ov::CompiledModel compiledModel;
+    ov::InferRequest reference;
+};
+
+TEST_F(RNNResidentStateTest, smoke_StateIsCarriedOverInferences) {
+    auto request = compiledModel.create_infer_request();
+    auto states = initialStates();
+    for (int i = 0; i < 4; i++)
+        inferAndCompare(request, states, i);
+}
+
+TEST_F(RNNResidentStateTest, smoke_Reset) {
+    auto request = compiledModel.create_infer_request();
+    auto states = initialStates();
+    for (int i = 0; i < 3; i++)
+        inferAndCompare(request, states, i);
+
+    getState(request, "H").reset();
+    states[0] = initialStates()[0];
+    inferAndCompare(request, states, 3);
+
+    for (auto& state : request.query_state())
+        state.reset();
+    states = initialStates();
+    for (int i = 4; i < 6; i++)
+        inferAndCompare(request, states, i);
+}
+
+TEST_F(RNNResidentStateTest, smoke_SetStateBetweenInferences) {
+    auto request = compiledModel.create_infer_request();
+    auto states = initialStates();
+    inferAndCompare(request, states, 0);
+
+    for (size_t s = 0; s < states.size(); s++) {
+        states[s] = ov::test::utils::create_and_fill_tensor(ov::element::f32, states[s].get_shape(), 2, -1, 100, 10 + s);
+        getState(request, stateNames[s]).set_state(states[s]);
+    }
+    for (int i = 1; i < 3; i++)
+        inferAndCompare(request, states, i);
+}
+
+TEST_F(RNNResidentStateTest, smoke_RequestsKeepSeparateStates) {
+    auto request1 = compiledModel.create_infer_request();
+    auto request2 = compiledModel.create_infer_request();
+    auto states1 = initialStates();
+    auto states2 = initialStates();
+    for (int i = 0; i < 3; i++) {
+        inferAndCompare(request1, states1, i);
+        inferAndCompare(request2, states2, 100 + i);
+        inferAndCompare(request2, states2, 200 + i);
+    }
+}
+
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<InputShape>,   // Input shapes
+        std::string                // Device name
+> SnippetsDynamicShapesParams;
+
+/* Eltwise chain with dynamic batch and sequence length is tokenized into a single Subgraph,
+   the kernels are reused for the shapes with the same innermost dims.
+
+    Input0[-1,-1,C]   Input1[-1,-1,C]
+             \           /
+                 Add
+                  |
+              Multiply(Const)
+                  |
+                Sigmoid
+                  |
+        Subtract(Input1)
+                  |
+                Output
+*/
+class SnippetsDynamicShapesTest : public testing::WithParamInterface<SnippetsDynamicShapesParams>,
+                                  virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsDynamicShapesParams> &obj) {
+        std::vector<InputShape> inputShapes;
+        std::string targetName;
+        std::tie(inputShapes, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=(";
+        for (const auto& shape : inputShapes) {
+            results << CommonTestUtils::partialShape2str({shape.first}) << "_";
+        }
+        results << ")_TS=(";
+        for (const auto& shape : inputShapes) {
+            for (const auto& item : shape.second) {
+                results << CommonTestUtils::vec2str(item) << "_";
+            }
+        }
+        results << ")_targetDevice=" << targetName;
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<InputShape> inputShapes;
+        std::tie(inputShapes, targetDevice) = this->GetParam();
+        init_input_shapes(inputShapes);
+
+        const auto precision = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+        auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+        auto scale = ngraph::builder::makeConstant<float>(precision, {1}, {0.5f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(add, scale);
+        auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(multiply);
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(sigmoid, params[1]);
+        function = makeNgraphFunction(precision, params, subtract, "SnippetsDynamicShapes");
+    }
+};
+
+TEST_P(SnippetsDynamicShapesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP();
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        {{-1, -1, 64}, {{1, 16, 64}, {2, 7, 64}, {1, 16, 64}, {4, 33, 64}}},
+        {{-1, -1, 64}, {{1, 16, 64}, {2, 7, 64}, {1, 16, 64}, {4, 33, 64}}}
+    },
+    // broadcasting of the outer dims
+    {
+        {{-1, -1, 19}, {{2, 5, 19}, {3, 9, 19}, {2, 5, 19}}},
+        {{1, -1, 19}, {{1, 5, 19}, {1, 9, 19}, {1, 1, 19}}}
+    },
+    // innermost dim is dynamic: a kernel per its value
+    {
+        {{-1, -1, -1}, {{1, 8, 16}, {2, 8, 3}, {1, 8, 16}}},
+        {{-1, -1, -1}, {{1, 8, 16}, {2, 8, 3}, {1, 1, 1}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsDynamicShapes, SnippetsDynamicShapesTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         SnippetsDynamicShapesTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,129 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using TensorIteratorMemoryBindingParams = std::tuple<InputShape,   // sequence shape [N, T, F], the iteration axis is 1
+                                                     int64_t>;     // stride of the sliced input and output
+
+/* The body memory of the static TensorIterator is bound to the outer buffers instead of copying:
+ * the sliced input and the concatenated output point to the chunks of the outer tensors (for N = 1),
+ * the back edge exchanges the memory of the body output and the body input. An odd number of iterations
+ * leaves the back edge memory exchanged at the end of the inference, so every shape is inferred twice.
+ * The dynamic TensorIterator reuses the back edge mappers of the previous iteration.
+
+    Sequence[N, T, F]   State[N, 1, F]
+          |                  |
+    -------------- TensorIterator ---------------
+    |   X[N, 1, F]         H[N, 1, F] <--------  |
+    |         \           /                   |  |
+    |              Add                        |  |
+    |            /     \                      |  |
+    |        Relu       Tanh -----------------   |
+    |         |          |                       |
+    |      Result      Result                    |
+    ---------------------------------------------
+          |                  |
+    Output[N, T, F]    LastState[N, 1, F]
+*/
+class TensorIteratorMemoryBindingTest : public testing::WithParamInterface<TensorIteratorMemoryBindingParams>,
+                                        virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TensorIteratorMemoryBindingParams> obj) {
+        InputShape shape;
+        int64_t stride;
+        std::tie(shape, stride) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+        for (const auto& item : shape.second) {
+            result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "stride=" << stride;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape shape;
+        int64_t stride;
+        std::tie(shape, stride) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const size_t sequenceAxis = 1;
+        InputShape stateShape{shape.first, {}};
+        stateShape.first[sequenceAxis] = 1;
+        for (auto targetShape : shape.second) {
+            targetShape[sequenceAxis] = 1;
+            stateShape.second.push_back(targetShape);
+        }
+        init_input_shapes({shape, stateShape});
+
+        const auto prc = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(prc, inputDynamicShapes);
+
+        auto sliceShape = inputDynamicShapes[0];
+        sliceShape[sequenceAxis] = 1;
+        auto bodyX = std::make_shared<ov::op::v0::Parameter>(prc, sliceShape);
+        auto bodyH = std::make_shared<ov::op::v0::Parameter>(prc, inputDynamicShapes[1]);
+        auto add = std::make_shared<ov::op::v1::Add>(bodyX, bodyH);
+        auto relu = std::make_shared<ov::op::v0::Relu>(add);
+        auto tanh = std::make_shared<ov::op::v0::Tanh>(add);
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{relu, tanh}, ov::ParameterVector{bodyX, bodyH}, "body");
+
+        auto tensorIterator = std::make_shared<ov::op::v0::TensorIterator>();
+        tensorIterator->set_function(body);
+        const int64_t start = stride > 0 ? 0 : -1;
+        const int64_t end = stride > 0 ? -1 : 0;
+        tensorIterator->set_sliced_input(bodyX, params[0], start, stride, 1, end, sequenceAxis);
+        tensorIterator->set_merged_input(bodyH, params[1], tanh);
+        auto output = tensorIterator->get_concatenated_slices(relu, start, stride, 1, end, sequenceAxis);
+        auto lastState = tensorIterator->get_iter_value(tanh, -1);
+
+        function = std::make_shared<ov::Model>(ov::OutputVector{output, lastState}, params, "TensorIteratorMemoryBinding");
+    }
+};
+
+TEST_P(TensorIteratorMemoryBindingTest, CompareWithRefs) {
+    run();
+}
+
+namespace {
+
+const std::vector<int64_t> strides = {1, -1};
+
+// the static shape is inferred twice
+const std::vector<InputShape> staticShapes = {
+    // the chunks are bound, the odd and the even numbers of iterations
+    {{1, 5, 8}, {{1, 5, 8}, {1, 5, 8}}},
+    {{1, 4, 8}, {{1, 4, 8}, {1, 4, 8}}},
+    {{1, 1, 8}, {{1, 1, 8}, {1, 1, 8}}},
+    // the chunks are not contiguous, they are copied
+    {{3, 5, 8}, {{3, 5, 8}, {3, 5, 8}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorMemoryBinding_Static, TensorIteratorMemoryBindingTest,
+                         ::testing::Combine(::testing::ValuesIn(staticShapes),
+                                            ::testing::ValuesIn(strides)),
+                         TensorIteratorMemoryBindingTest::getTestCaseName);
+
+const std::vector<InputShape> dynamicShapes = {
+    // the shapes of the back edges are kept between the iterations and between some of the inferences
+    {{-1, -1, 8}, {{1, 5, 8}, {1, 5, 8}, {1, 2, 8}, {3, 3, 8}, {1, 5, 8}}},
+    {{1, {1, 10}, {1, 16}}, {{1, 3, 4}, {1, 7, 16}, {1, 7, 16}, {1, 3, 4}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorMemoryBinding_Dynamic, TensorIteratorMemoryBindingTest,
+                         ::testing::Combine(::testing::ValuesIn(dynamicShapes),
+                                            ::testing::ValuesIn(strides)),
+                         TensorIteratorMemoryBindingTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
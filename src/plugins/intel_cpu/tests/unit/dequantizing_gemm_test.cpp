@@ -0,0 +1,189 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "nodes/common/dequantizing_gemm.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct CompressedMatMul {
+    std::vector<float> src;
+    std::vector<uint8_t> weights;
+    std::vector<float> scales;
+    std::vector<float> zeroPoints;
+    std::vector<float> bias;
+};
+
+CompressedMatMul randomData(size_t M, size_t N, size_t K, size_t groupsNum) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    CompressedMatMul data{std::vector<float>(M * K), std::vector<uint8_t>(N * K), std::vector<float>(N * groupsNum),
+                          std::vector<float>(N * groupsNum), std::vector<float>(N)};
+    for (auto& val : data.src)
+        val = distribution(gen);
+    for (auto& val : data.weights)
+        val = static_cast<uint8_t>(gen());
+    for (auto& val : data.scales)
+        val = distribution(gen) * 0.1f;
+    for (auto& val : data.zeroPoints)
+        val = std::round(distribution(gen) * 8.f);
+    for (auto& val : data.bias)
+        val = distribution(gen);
+    return data;
+}
+
+// Reference: the weights are dequantized completely, the accumulation is in double.
+std::vector<float> referenceMatMul(const CompressedMatMul& data, size_t M, size_t N, size_t K, size_t groupsNum,
+                                   bool isSigned, bool withZeroPoints) {
+    const size_t groupSize = K / groupsNum;
+    std::vector<float> dst(M * N);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            double sum = data.bias[n];
+            for (size_t k = 0; k < K; k++) {
+                const uint8_t w = data.weights[n * K + k];
+                const float value = isSigned ? static_cast<float>(static_cast<int8_t>(w)) : static_cast<float>(w);
+                const size_t g = n * groupsNum + k / groupSize;
+                const float zeroPoint = withZeroPoints ? data.zeroPoints[g] : 0.f;
+                sum += static_cast<double>(data.src[m * K + k]) * (value - zeroPoint) * data.scales[g];
+            }
+            dst[m * N + n] = static_cast<float>(sum);
+        }
+    }
+    return dst;
+}
+
+}   // namespace
+
+using DequantizingGemmParams = std::tuple<size_t,   // M
+                                          size_t,   // N
+                                          size_t,   // K
+                                          size_t,   // groups number
+                                          bool,     // signed weights
+                                          bool,     // with zero points
+                                          int>;     // threads number
+
+class DequantizingGemmTest : public ::testing::TestWithParam<DequantizingGemmParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DequantizingGemmParams>& obj) {
+        size_t M, N, K, groupsNum;
+        bool isSigned, withZeroPoints;
+        int nthr;
+        std::tie(M, N, K, groupsNum, isSigned, withZeroPoints, nthr) = obj.param;
+        std::ostringstream result;
+        result << "M" << M << "_N" << N << "_K" << K << "_groups" << groupsNum << (isSigned ? "_i8" : "_u8")
+               << (withZeroPoints ? "_zp" : "_noZp") << "_nthr" << nthr;
+        return result.str();
+    }
+};
+
+TEST_P(DequantizingGemmTest, compareWithReference) {
+    size_t M, N, K, groupsNum;
+    bool isSigned, withZeroPoints;
+    int nthr;
+    std::tie(M, N, K, groupsNum, isSigned, withZeroPoints, nthr) = GetParam();
+
+    const auto data = randomData(M, N, K, groupsNum);
+    const auto ref = referenceMatMul(data, M, N, K, groupsNum, isSigned, withZeroPoints);
+
+    const DecompressionWeights weights{data.weights.data(), isSigned, data.scales.data(),
+                                       withZeroPoints ? data.zeroPoints.data() : nullptr, K / groupsNum};
+    std::vector<float> dst(M * N);
+    dequantizingGemm(data.src.data(), dst.data(), data.bias.data(), M, N, K, weights, nthr);
+
+    for (size_t i = 0; i < dst.size(); i++)
+        ASSERT_NEAR(ref[i], dst[i], 1e-3f * std::max(1.f, std::fabs(ref[i]))) << "at index " << i;
+}
+
+// M from 16 uses the tiled path
+INSTANTIATE_TEST_SUITE_P(smoke_DequantizingGemm, DequantizingGemmTest,
+                         ::testing::Combine(
+                            ::testing::Values(1, 5, 17, 40),
+                            ::testing::Values(1, 33),
+                            ::testing::Values(96, 512),
+                            ::testing::Values(1, 4),
+                            ::testing::Bool(),
+                            ::testing::Bool(),
+                            ::testing::Values(1, 3)),
+                         DequantizingGemmTest::getTestCaseName);
+
+TEST(DequantizingGemmTest, withoutBias) {
+    const size_t M = 2, N = 3, K = 4;
+    const std::vector<float> src = { 1.f, 2.f, 3.f, 4.f,
+                                     -1.f, 0.f, 1.f, 0.5f };
+    const std::vector<int8_t> weights = { 1, 0, 0, 0,
+                                          0, -2, 0, 2,
+                                          1, 1, 1, 1 };
+    const std::vector<float> scales = { 2.f, 0.5f, 1.f };
+    std::vector<float> dst(M * N);
+
+    dequantizingGemm(src.data(), dst.data(), nullptr, M, N, K, DecompressionWeights{weights.data(), true, scales.data(), nullptr, K});
+
+    ASSERT_EQ(dst, std::vector<float>({ 2.f, 2.f, 10.f,
+                                        -2.f, 0.5f, 0.5f }));
+}
+
+TEST(DequantizingGemmTest, decompressWeights) {
+    const size_t N = 2, K = 4;
+    const std::vector<uint8_t> weights = { 1, 2, 3, 4,
+                                           10, 0, 255, 8 };
+    const std::vector<float> scales = { 2.f, 1.f,
+                                        0.5f, 0.25f };
+    const std::vector<float> zeroPoints = { 1.f, 0.f,
+                                            2.f, 8.f };
+    std::vector<float> dst(N * K);
+
+    decompressWeights(DecompressionWeights{weights.data(), false, scales.data(), zeroPoints.data(), 2}, N, K, dst.data());
+    ASSERT_EQ(dst, std::vector<float>({ 0.f, 2.f, 3.f, 4.f,
+                                        4.f, -1.f, 61.75f, 0.f }));
+
+    decompressWeights(DecompressionWeights{weights.data(), true, scales.data(), nullptr, 2}, N, K, dst.data());
+    ASSERT_EQ(dst, std::vector<float>({ 2.f, 4.f, 3.f, 4.f,
+                                        5.f, 0.f, -0.25f, 2.f }));
+}
+
+// Memory bound case of the token generation compared to fp32 weights, run with --gtest_also_run_disabled_tests
+TEST(DequantizingGemmPerf, DISABLED_compressedVsFp32) {
+    const size_t N = 4096, K = 4096, groupsNum = 32;
+    const size_t iterations = 20;
+
+    for (size_t M : { 1, 4, 32 }) {
+        const auto data = randomData(M, N, K, groupsNum);
+        std::vector<float> weightsFp32(N * K);
+        for (size_t i = 0; i < weightsFp32.size(); i++)
+            weightsFp32[i] = static_cast<float>(data.weights[i]) * data.scales[i / (K / groupsNum)];
+        std::vector<float> dst(M * N);
+
+        const DecompressionWeights weights{data.weights.data(), false, data.scales.data(), data.zeroPoints.data(), K / groupsNum};
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            dequantizingGemm(data.src.data(), dst.data(), data.bias.data(), M, N, K, weights);
+        std::chrono::duration<double, std::milli> compressed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++) {
+            InferenceEngine::parallel_for(N, [&](size_t n) {
+                for (size_t m = 0; m < M; m++) {
+                    float sum = data.bias[n];
+                    for (size_t k = 0; k < K; k++)
+                        sum += data.src[m * K + k] * weightsFp32[n * K + k];
+                    dst[m * N + n] = sum;
+                }
+            });
+        }
+        std::chrono::duration<double, std::milli> fp32 = std::chrono::steady_clock::now() - start;
+
+        std::cout << "M=" << M << " N=" << N << " K=" << K << ": compressed " << compressed.count() / iterations
+                  << " ms, fp32 " << fp32.count() / iterations << " ms" << std::endl;
+    }
+}
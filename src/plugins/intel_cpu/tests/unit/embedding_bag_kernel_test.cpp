@@ -0,0 +1,239 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "nodes/kernels/embedding_bag_kernel.hpp"
+#include "utils/bfloat16.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu;
+
+namespace {
+
+enum class ScaleType { NONE, COMMON, PER_ROW };
+
+struct EmbeddingTable {
+    Precision prc;
+    size_t rows;
+    size_t rowSize;
+    std::vector<uint8_t> data;
+    std::vector<float> scales;
+
+    float value(size_t row, size_t i) const {
+        const size_t idx = row * rowSize + i;
+        switch (prc) {
+            case Precision::FP32: return reinterpret_cast<const float*>(data.data())[idx];
+            case Precision::BF16: return bfloat16_t::from_bits(reinterpret_cast<const uint16_t*>(data.data())[idx]);
+            case Precision::I8: return reinterpret_cast<const int8_t*>(data.data())[idx];
+            default: return data[idx];
+        }
+    }
+};
+
+EmbeddingTable makeTable(Precision prc, size_t rows, size_t rowSize, ScaleType scaleType) {
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> distribution(-100, 100);
+    EmbeddingTable table{prc, rows, rowSize, std::vector<uint8_t>(rows * rowSize * prc.size()), {}};
+    for (size_t i = 0; i < rows * rowSize; i++) {
+        const int value = distribution(gen);
+        switch (prc) {
+            case Precision::FP32: reinterpret_cast<float*>(table.data.data())[i] = value / 8.f; break;
+            case Precision::BF16: reinterpret_cast<bfloat16_t*>(table.data.data())[i] = value / 8.f; break;
+            case Precision::I8: reinterpret_cast<int8_t*>(table.data.data())[i] = static_cast<int8_t>(value); break;
+            default: table.data[i] = static_cast<uint8_t>(value + 100); break;
+        }
+    }
+    if (scaleType == ScaleType::COMMON)
+        table.scales = { 0.125f };
+    if (scaleType == ScaleType::PER_ROW) {
+        for (size_t r = 0; r < rows; r++)
+            table.scales.push_back(0.01f * static_cast<float>(r % 7 + 1));
+    }
+    return table;
+}
+
+std::vector<int> randomIndices(size_t count, size_t rows) {
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> distribution(0, static_cast<int>(rows) - 1);
+    std::vector<int> indices(count);
+    for (auto & idx : indices)
+        idx = distribution(gen);
+    return indices;
+}
+
+std::shared_ptr<jitEmbeddingBagKernelBase> createKernel(const EmbeddingTable & table, bool withWeights, size_t workAmount) {
+    jEmbeddingBagConfParams jcp;
+    jcp.tablePrc = table.prc;
+    jcp.rowSize = table.rowSize;
+    jcp.workAmount = workAmount;
+    jcp.withWeights = withWeights;
+    jcp.withRowScales = table.scales.size() > 1;
+    jcp.withScale = table.scales.size() == 1;
+    jcp.prefetchDistance = 8;
+
+    std::shared_ptr<jitEmbeddingBagKernelBase> kernel;
+    if (x64::mayiuse(x64::avx512_core)) {
+        kernel.reset(new jitUniEmbeddingBagKernel<x64::avx512_core>(jcp));
+    } else {
+        kernel.reset(new jitUniEmbeddingBagKernel<x64::avx2>(jcp));
+    }
+    kernel->create_ker();
+    return kernel;
+}
+
+size_t kernelWorkAmount(size_t rowSize) {
+    const size_t dataElPerVec = (x64::mayiuse(x64::avx512_core) ? 64 : 32) / sizeof(float);
+    return rowSize - rowSize % dataElPerVec;
+}
+
+void runKernel(jitEmbeddingBagKernelBase & kernel, const EmbeddingTable & table, const std::vector<int> & indices,
+               const std::vector<float> & weights, size_t bagSize, std::vector<float> & dst) {
+    for (size_t bag = 0; bag < indices.size() / bagSize; bag++) {
+        jEmbeddingBagCallArgs args;
+        args.table = table.data.data();
+        args.indices = indices.data() + bag * bagSize;
+        args.weights = weights.empty() ? nullptr : weights.data() + bag * bagSize;
+        args.scales = table.scales.empty() ? nullptr : table.scales.data();
+        args.dst = dst.data() + bag * table.rowSize;
+        args.indicesNum = bagSize;
+        kernel(&args);
+    }
+}
+
+}   // namespace
+
+using EmbeddingBagKernelParams = std::tuple<Precision,   // table precision
+                                            size_t,      // row size
+                                            size_t,      // bag size
+                                            bool,        // with weights
+                                            ScaleType>;
+
+class EmbeddingBagKernelTest : public ::testing::TestWithParam<EmbeddingBagKernelParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagKernelParams> & obj) {
+        Precision prc;
+        size_t rowSize, bagSize;
+        bool withWeights;
+        ScaleType scaleType;
+        std::tie(prc, rowSize, bagSize, withWeights, scaleType) = obj.param;
+        std::ostringstream result;
+        result << "table=" << prc.name() << "_rowSize=" << rowSize << "_bagSize=" << bagSize
+               << (withWeights ? "_withWeights" : "")
+               << (scaleType == ScaleType::COMMON ? "_commonScale" : scaleType == ScaleType::PER_ROW ? "_perRowScale" : "");
+        return result.str();
+    }
+};
+
+TEST_P(EmbeddingBagKernelTest, compareWithReference) {
+    if (!x64::mayiuse(x64::avx2))
+        GTEST_SKIP();
+
+    Precision prc;
+    size_t rowSize, bagSize;
+    bool withWeights;
+    ScaleType scaleType;
+    std::tie(prc, rowSize, bagSize, withWeights, scaleType) = GetParam();
+
+    const size_t rows = 37, bags = 5;
+    const auto table = makeTable(prc, rows, rowSize, scaleType);
+    const auto indices = randomIndices(bags * bagSize, rows);
+    std::vector<float> weights;
+    if (withWeights) {
+        for (size_t i = 0; i < indices.size(); i++)
+            weights.push_back(0.5f + static_cast<float>(i % 3));
+    }
+
+    const size_t workAmount = kernelWorkAmount(rowSize);
+    auto kernel = createKernel(table, withWeights, workAmount);
+    std::vector<float> dst(bags * rowSize, -1.f);
+    runKernel(*kernel, table, indices, weights, bagSize, dst);
+
+    for (size_t bag = 0; bag < bags; bag++) {
+        for (size_t i = 0; i < rowSize; i++) {
+            const float actual = dst[bag * rowSize + i];
+            if (i >= workAmount) {
+                // the rest of the row is not touched by the kernel
+                ASSERT_EQ(actual, -1.f);
+                continue;
+            }
+            float expected = 0.f;
+            for (size_t j = 0; j < bagSize; j++) {
+                const int idx = indices[bag * bagSize + j];
+                float factor = withWeights ? weights[bag * bagSize + j] : 1.f;
+                if (table.scales.size() > 1)
+                    factor *= table.scales[idx];
+                expected += table.value(idx, i) * factor;
+            }
+            if (table.scales.size() == 1)
+                expected *= table.scales[0];
+            ASSERT_NEAR(actual, expected, 1e-3f * std::max(1.f, std::abs(expected))) << "bag " << bag << " at index " << i;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagKernel, EmbeddingBagKernelTest,
+                         ::testing::Combine(
+                            ::testing::Values(Precision::FP32, Precision::BF16, Precision::I8, Precision::U8),
+                            ::testing::Values(8, 35, 64, 100),
+                            ::testing::Values(1, 13),
+                            ::testing::Bool(),
+                            ::testing::Values(ScaleType::NONE)),
+                         EmbeddingBagKernelTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagKernelDequantization, EmbeddingBagKernelTest,
+                         ::testing::Combine(
+                            ::testing::Values(Precision::I8, Precision::U8),
+                            ::testing::Values(16, 100),
+                            ::testing::Values(13),
+                            ::testing::Bool(),
+                            ::testing::Values(ScaleType::COMMON, ScaleType::PER_ROW)),
+                         EmbeddingBagKernelTest::getTestCaseName);
+
+// Throughput of the bag accumulation for the table size, pooling factor and embedding dimension,
+// run with --gtest_also_run_disabled_tests
+TEST(EmbeddingBagKernelPerf, DISABLED_tableSizePoolingFactorEmbeddingDim) {
+    if (!x64::mayiuse(x64::avx2))
+        GTEST_SKIP();
+
+    const std::vector<size_t> tableRows = { 1000, 50000, 250000 };
+    const std::vector<size_t> poolingFactors = { 1, 20, 100 };
+    const std::vector<size_t> embeddingDims = { 16, 64, 256 };
+    const std::vector<std::pair<Precision, ScaleType>> tableTypes = {
+        { Precision::FP32, ScaleType::NONE }, { Precision::BF16, ScaleType::NONE }, { Precision::I8, ScaleType::PER_ROW } };
+    const size_t bags = 2048;
+    const size_t iterations = 10;
+
+    for (const auto & tableType : tableTypes) {
+        for (auto rows : tableRows) {
+            for (auto dim : embeddingDims) {
+                const auto table = makeTable(tableType.first, rows, dim, tableType.second);
+                for (auto pooling : poolingFactors) {
+                    const auto indices = randomIndices(bags * pooling, rows);
+                    auto kernel = createKernel(table, false, kernelWorkAmount(dim));
+                    std::vector<float> dst(bags * dim);
+                    runKernel(*kernel, table, indices, {}, pooling, dst);
+
+                    auto start = std::chrono::steady_clock::now();
+                    for (size_t i = 0; i < iterations; i++)
+                        runKernel(*kernel, table, indices, {}, pooling, dst);
+                    std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+
+                    const double avg = duration.count() / iterations;
+                    std::cout << tableType.first.name() << " rows=" << rows << " dim=" << dim << " pooling=" << pooling << ": "
+                              << avg << " us, " << bags * pooling * dim * tableType.first.size() / avg / 1000.0 << " GB/s" << std::endl;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "nodes/common/hash_unique.h"
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+struct UniqueOutputs {
+    std::vector<int32_t> first;
+    std::vector<int32_t> inToOut;
+    std::vector<int32_t> occurrences;
+};
+
+// Reference: the key of the slice is the sequence of its elements in the part by part order.
+UniqueOutputs referenceUnique(const std::vector<int>& src, size_t cmpBlNum, size_t partsInBl, size_t elPerPart, bool sorted) {
+    std::vector<std::vector<int>> keys(cmpBlNum);
+    for (size_t b = 0; b < cmpBlNum; b++) {
+        for (size_t p = 0; p < partsInBl; p++) {
+            auto part = src.begin() + (p * cmpBlNum + b) * elPerPart;
+            keys[b].insert(keys[b].end(), part, part + elPerPart);
+        }
+    }
+
+    std::map<std::vector<int>, size_t> firstOf;
+    std::vector<size_t> uniques;
+    for (size_t b = 0; b < cmpBlNum; b++) {
+        if (firstOf.emplace(keys[b], b).second)
+            uniques.push_back(b);
+    }
+    if (sorted) {
+        uniques.clear();
+        for (const auto& it : firstOf)
+            uniques.push_back(it.second);
+    }
+
+    UniqueOutputs ref;
+    std::map<std::vector<int>, int32_t> uniqueIdx;
+    for (size_t u = 0; u < uniques.size(); u++) {
+        uniqueIdx[keys[uniques[u]]] = static_cast<int32_t>(u);
+        ref.first.push_back(static_cast<int32_t>(uniques[u]));
+    }
+    ref.occurrences.resize(uniques.size(), 0);
+    for (size_t b = 0; b < cmpBlNum; b++) {
+        ref.inToOut.push_back(uniqueIdx[keys[b]]);
+        ref.occurrences[uniqueIdx[keys[b]]]++;
+    }
+    return ref;
+}
+
+std::vector<int> randomData(size_t size, int range) {
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int> distribution(-range, range);
+    std::vector<int> data(size);
+    for (auto& val : data)
+        val = distribution(gen);
+    return data;
+}
+
+}   // namespace
+
+using HashUniqueParams = std::tuple<size_t,   // keys number
+                                    size_t,   // parts in slice
+                                    size_t,   // elements in part
+                                    int,      // values range
+                                    bool,     // sorted
+                                    int>;     // threads number
+
+class HashUniqueTest : public ::testing::TestWithParam<HashUniqueParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<HashUniqueParams>& obj) {
+        size_t keysNum, partsInBl, elPerPart;
+        int range, nthr;
+        bool sorted;
+        std::tie(keysNum, partsInBl, elPerPart, range, sorted, nthr) = obj.param;
+        std::ostringstream result;
+        result << "keys=" << keysNum << "_parts=" << partsInBl << "_elPerPart=" << elPerPart << "_range=" << range
+               << (sorted ? "_sorted" : "_unsorted") << "_nthr=" << nthr;
+        return result.str();
+    }
+};
+
+TEST_P(HashUniqueTest, compareWithReference) {
+    size_t keysNum, partsInBl, elPerPart;
+    int range, nthr;
+    bool sorted;
+    std::tie(keysNum, partsInBl, elPerPart, range, sorted, nthr) = GetParam();
+
+    const auto src = randomData(keysNum * partsInBl * elPerPart, range);
+    const auto ref = referenceUnique(src, keysNum, partsInBl, elPerPart, sorted);
+
+    UniqueOutputs actual{std::vector<int32_t>(keysNum), std::vector<int32_t>(keysNum), std::vector<int32_t>(keysNum)};
+    size_t uniqueLen = 0;
+    if (partsInBl == 1 && elPerPart == 1) {
+        uniqueLen = hashUnique(FlatUniqueKeys<int>{src.data()}, keysNum, sorted,
+                               actual.first.data(), actual.inToOut.data(), actual.occurrences.data(), nthr);
+    } else {
+        const SlicedUniqueKeys<int> keys{src.data(), keysNum, partsInBl, elPerPart};
+        uniqueLen = hashUnique(keys, keysNum, sorted, actual.first.data(), actual.inToOut.data(), actual.occurrences.data(), nthr);
+    }
+    actual.first.resize(uniqueLen);
+    actual.occurrences.resize(uniqueLen);
+
+    ASSERT_EQ(ref.first, actual.first);
+    ASSERT_EQ(ref.inToOut, actual.inToOut);
+    ASSERT_EQ(ref.occurrences, actual.occurrences);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_HashUniqueFlatten, HashUniqueTest,
+                         ::testing::Combine(
+                            ::testing::Values(1, 100, 50000),
+                            ::testing::Values(1),
+                            ::testing::Values(1),
+                            ::testing::Values(3, 1000, 1000000),
+                            ::testing::Bool(),
+                            ::testing::Values(1, 4, 7)),
+                         HashUniqueTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_HashUniqueSliced, HashUniqueTest,
+                         ::testing::Combine(
+                            ::testing::Values(17, 20000),
+                            ::testing::Values(1, 3),
+                            ::testing::Values(2, 5),
+                            ::testing::Values(1, 2),
+                            ::testing::Bool(),
+                            ::testing::Values(1, 4)),
+                         HashUniqueTest::getTestCaseName);
+
+TEST(HashUniqueTest, floatZerosAndNaN) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const std::vector<float> src = { nan, 1.f, -0.f, nan, 0.f, -1.f, 1.f };
+    std::vector<int32_t> first(src.size()), inToOut(src.size()), occurrences(src.size());
+
+    const auto uniqueLen = hashUnique(FlatUniqueKeys<float>{src.data()}, src.size(), true,
+                                      first.data(), inToOut.data(), occurrences.data());
+
+    // -0.0 and 0.0 are the same value, NaN is not equal to any value and is placed at the end
+    ASSERT_EQ(uniqueLen, 5lu);
+    first.resize(uniqueLen);
+    occurrences.resize(uniqueLen);
+    ASSERT_EQ(first, std::vector<int32_t>({ 5, 2, 1, 0, 3 }));
+    ASSERT_EQ(inToOut, std::vector<int32_t>({ 3, 2, 1, 4, 1, 0, 2 }));
+    ASSERT_EQ(occurrences, std::vector<int32_t>({ 1, 2, 2, 1, 1 }));
+}
+
+// Scaling of the unique search with the number of threads, run with --gtest_also_run_disabled_tests
+TEST(HashUniquePerf, DISABLED_threadsScaling) {
+    const std::vector<size_t> keysNums = { 100000, 1000000, 10000000 };
+    const std::vector<int> ranges = { 1000, 1000000, 100000000 };
+    const size_t iterations = 5;
+
+    std::vector<int> threads;
+    for (int nthr = 1; nthr < parallel_get_max_threads(); nthr *= 2)
+        threads.push_back(nthr);
+    threads.push_back(parallel_get_max_threads());
+
+    for (auto keysNum : keysNums) {
+        for (auto range : ranges) {
+            const auto src = randomData(keysNum, range);
+            std::vector<int32_t> first(keysNum), inToOut(keysNum), occurrences(keysNum);
+            for (bool sorted : { false, true }) {
+                for (auto nthr : threads) {
+                    size_t uniqueLen = 0;
+                    auto start = std::chrono::steady_clock::now();
+                    for (size_t i = 0; i < iterations; i++) {
+                        uniqueLen = hashUnique(FlatUniqueKeys<int>{src.data()}, keysNum, sorted,
+                                               first.data(), inToOut.data(), occurrences.data(), nthr);
+                    }
+                    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+                    std::cout << "keys=" << keysNum << " unique=" << uniqueLen << (sorted ? " sorted" : " unsorted")
+                              << " nthr=" << nthr << ": " << duration.count() / iterations << " ms" << std::endl;
+                }
+            }
+        }
+    }
+}
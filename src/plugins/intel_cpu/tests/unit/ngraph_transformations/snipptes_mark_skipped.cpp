@@ -4,9 +4,11 @@
 #include <gtest/gtest.h>
 #include <subgraph_simple.hpp>
 #include <subgraph_customizable.hpp>
+#include <subgraph_mvn.hpp>
 #include <snippets_helpers.hpp>
 #include <ngraph_transformations/snippets_mark_skipped.hpp>
 #include "snippets/pass/tokenization.hpp"
+#include <openvino/pass/manager.hpp>
 
 namespace ov {
 namespace test {
@@ -60,6 +62,42 @@ TEST_F(SnippetsMarkSkippedTests, smoke_SkipConvFused_ConvSumActivation) {
     run();
 }
 
+TEST_F(SnippetsMarkSkippedTests, smoke_Snippets_Batch1LayerNorm) {
+    const auto &f = AddMVNFunction(std::vector<PartialShape> {{1, 16, 64}, {1, 16, 64}}, true, ov::op::MVNEpsMode::INSIDE_SQRT);
+    function = f.getOriginal();
+    // Fully tokenizable, since the kernel call is small enough to be executed without parallelism
+    function_ref = f.getReference();
+    run();
+}
+
+namespace {
+bool isMVNSkipped(const std::vector<PartialShape>& inputShapes) {
+    const auto &f = AddMVNFunction(inputShapes, true, ov::op::MVNEpsMode::INSIDE_SQRT);
+    auto function = f.getOriginal();
+    ov::pass::Manager manager;
+    manager.register_pass<ov::intel_cpu::SnippetsMarkSkipped>();
+    manager.run_passes(function);
+    for (const auto& op : function->get_ops()) {
+        if (ov::is_type<ov::op::v6::MVN>(op))
+            return ngraph::snippets::pass::GetSnippetsNodeType(op) == ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin;
+    }
+    return false;
+}
+}  // namespace
+
+// The heuristic depends on the shape only, so the cases don't depend on the number of threads
+TEST(SnippetsMarkSkippedMVNTests, smoke_Snippets_SkipMVNWithoutParallelWork) {
+    // the batch-1 LayerNorm of a long sequence is executed by the parallel MVN node
+    ASSERT_TRUE(isMVNSkipped({{1, 128, 768}, {1, 128, 768}}));
+    ASSERT_FALSE(isMVNSkipped({{16, 128, 768}, {16, 128, 768}}));
+    ASSERT_FALSE(isMVNSkipped({{1, 5, 16, 35}, {1, 5, 16, 35}}));
+}
+
+TEST(SnippetsMarkSkippedMVNTests, smoke_Snippets_SkipMVNWithLargeRows) {
+    ASSERT_TRUE(isMVNSkipped({{16, 2, 16384}, {16, 2, 16384}}));
+    ASSERT_FALSE(isMVNSkipped({{16, 2, 4096}, {16, 2, 4096}}));
+}
+
 }  // namespace snippets
 }  // namespace test
 }  // namespace ov
\ No newline at end of file
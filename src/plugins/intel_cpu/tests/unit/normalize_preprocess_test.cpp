@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <normalize_preprocess.h>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+const std::vector<float> meanValues = { 123.675f, 116.28f, 103.53f };
+const std::vector<float> stdScales = { 58.395f, 57.12f, 57.375f };
+
+InputInfo::Ptr meanValuesInfo() {
+    auto info = std::make_shared<InputInfo>();
+    auto & pp = info->getPreProcess();
+    pp.init(meanValues.size());
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        pp[c]->meanValue = meanValues[c];
+        pp[c]->stdScale = stdScales[c];
+    }
+    pp.setVariant(MEAN_VALUE);
+    return info;
+}
+
+InputInfo::Ptr meanImageInfo(size_t H, size_t W, std::vector<float> & meanImage) {
+    auto info = std::make_shared<InputInfo>();
+    auto & pp = info->getPreProcess();
+    pp.init(meanValues.size());
+    meanImage.resize(meanValues.size() * H * W);
+    for (size_t c = 0; c < meanValues.size(); c++) {
+        auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {H, W}, Layout::HW));
+        blob->allocate();
+        for (size_t i = 0; i < H * W; i++) {
+            blob->data()[i] = meanImage[c * H * W + i] = static_cast<float>((c * 7 + i) % 255);
+        }
+        pp.setMeanImageForChannel(blob, c);
+    }
+    pp.setVariant(MEAN_IMAGE);
+    return info;
+}
+
+std::vector<float> randomImage(size_t size) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> distribution(0.f, 255.f);
+    std::vector<float> image(size);
+    for (auto & value : image)
+        value = distribution(gen);
+    return image;
+}
+
+std::vector<float> refNormalize(const std::vector<float> & src, const VectorDims & dims, Layout layout) {
+    const size_t C = dims[1];
+    const size_t planeSize = dims[2] * dims[3];
+    std::vector<float> dst(src.size());
+    for (size_t i = 0; i < src.size(); i++) {
+        const size_t c = layout == NCHW ? i / planeSize % C : i % C;
+        dst[i] = (src[i] - meanValues[c]) / stdScales[c];
+    }
+    return dst;
+}
+
+void expectNear(const std::vector<float> & actual, const std::vector<float> & expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        ASSERT_NEAR(actual[i], expected[i], 1e-5f) << "at index " << i;
+    }
+}
+
+}   // namespace
+
+using NormalizePreprocessParams = std::tuple<VectorDims, Layout>;
+
+class NormalizePreprocessTest : public ::testing::TestWithParam<NormalizePreprocessParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<NormalizePreprocessParams> & obj) {
+        VectorDims dims;
+        Layout layout;
+        std::tie(dims, layout) = obj.param;
+        std::ostringstream result;
+        result << "dims=";
+        for (auto dim : dims)
+            result << dim << "_";
+        result << "layout=" << layout;
+        return result.str();
+    }
+};
+
+TEST_P(NormalizePreprocessTest, meanValuesInPlace) {
+    VectorDims dims;
+    Layout layout;
+    std::tie(dims, layout) = GetParam();
+    Shape shape(dims);
+
+    NormalizePreprocess normalize;
+    normalize.Load(shape, meanValuesInfo());
+
+    auto image = randomImage(shape.getElementsCount());
+    const auto expected = refNormalize(image, dims, layout);
+    normalize.NormalizeImage(shape, image.data(), layout);
+    expectNear(image, expected);
+}
+
+TEST_P(NormalizePreprocessTest, meanValuesFusedWithCopy) {
+    VectorDims dims;
+    Layout layout;
+    std::tie(dims, layout) = GetParam();
+    Shape shape(dims);
+
+    NormalizePreprocess normalize;
+    normalize.Load(shape, meanValuesInfo());
+
+    const auto image = randomImage(shape.getElementsCount());
+    std::vector<float> result(image.size());
+    normalize.NormalizeImage(shape, image.data(), result.data(), layout);
+    expectNear(result, refNormalize(image, dims, layout));
+}
+
+TEST_P(NormalizePreprocessTest, meanImage) {
+    VectorDims dims;
+    Layout layout;
+    std::tie(dims, layout) = GetParam();
+    if (layout != NCHW)
+        GTEST_SKIP();
+    Shape shape(dims);
+
+    std::vector<float> meanImage;
+    NormalizePreprocess normalize;
+    normalize.Load(shape, meanImageInfo(dims[2], dims[3], meanImage));
+
+    const auto image = randomImage(shape.getElementsCount());
+    std::vector<float> result(image.size());
+    normalize.NormalizeImage(shape, image.data(), result.data(), layout);
+
+    std::vector<float> expected(image.size());
+    for (size_t i = 0; i < image.size(); i++)
+        expected[i] = image[i] - meanImage[i % meanImage.size()];
+    expectNear(result, expected);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_NormalizePreprocess, NormalizePreprocessTest,
+                         ::testing::Combine(
+                            ::testing::Values(VectorDims{1, 3, 1, 1},
+                                              VectorDims{1, 3, 7, 5},
+                                              VectorDims{2, 3, 16, 16},
+                                              VectorDims{1, 3, 67, 129}),
+                            ::testing::Values(NCHW, NHWC)),
+                         NormalizePreprocessTest::getTestCaseName);
+
+// Throughput of the normalization at the common image sizes, run with --gtest_also_run_disabled_tests
+TEST(NormalizePreprocessPerf, DISABLED_imageSizes) {
+    const std::vector<std::pair<size_t, size_t>> sizes = { {224, 224}, {640, 640}, {1080, 1920} };
+    const size_t iterations = 100;
+
+    for (const auto & size : sizes) {
+        for (auto layout : { NCHW, NHWC }) {
+            Shape shape(VectorDims{1, 3, size.first, size.second});
+            NormalizePreprocess normalize;
+            normalize.Load(shape, meanValuesInfo());
+
+            const auto image = randomImage(shape.getElementsCount());
+            std::vector<float> result(image.size());
+            normalize.NormalizeImage(shape, image.data(), result.data(), layout);
+
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+                normalize.NormalizeImage(shape, image.data(), result.data(), layout);
+            std::chrono::duration<double, std::micro> duration = std::chrono::steady_clock::now() - start;
+
+            const double avg = duration.count() / iterations;
+            std::cout << size.first << "x" << size.second << " " << layout << ": " << avg << " us, "
+                      << image.size() * sizeof(float) * 2 / avg / 1000.0 << " GB/s" << std::endl;
+        }
+    }
+}
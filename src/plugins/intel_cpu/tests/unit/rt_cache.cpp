@@ -317,6 +317,29 @@ TEST(MultiCacheTests, Empty) {
     }
 }
 
+TEST(MultiCacheTests, Size) {
+    constexpr size_t capacity = 10;
+
+    auto intBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity);
+    ASSERT_EQ(cache.size(), 0);
+
+    for (int i = 0; i < capacity / 2; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    ASSERT_EQ(cache.size(), capacity / 2);
+
+    //every entry is limited by the capacity
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+        cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+    }
+    ASSERT_EQ(cache.size(), 2 * capacity);
+}
+
 namespace {
 class ScopedThread {
 public:
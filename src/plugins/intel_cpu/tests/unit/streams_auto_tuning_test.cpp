@@ -0,0 +1,42 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "streams_auto_tuning.h"
+#include <ie_plugin_config.hpp>
+#include "openvino/runtime/properties.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+std::vector<std::pair<int, int>> toPairs(const std::vector<StreamsCandidate>& candidates) {
+    std::vector<std::pair<int, int>> result;
+    for (const auto& candidate : candidates)
+        result.emplace_back(candidate.streams, candidate.threads);
+    return result;
+}
+
+}   // namespace
+
+TEST(StreamsAutoTuningTest, throughputCandidates) {
+    // the heuristic choice goes first, the duplicates are skipped
+    ASSERT_EQ(toPairs(makeStreamsCandidates(CONFIG_VALUE(THROUGHPUT), 4, 16)),
+              (std::vector<std::pair<int, int>>{{4, 0}, {16, 0}, {8, 0}, {2, 0}}));
+    ASSERT_EQ(toPairs(makeStreamsCandidates(CONFIG_VALUE(THROUGHPUT), 3, 4)),
+              (std::vector<std::pair<int, int>>{{3, 0}, {4, 0}, {2, 0}, {1, 0}}));
+    ASSERT_EQ(toPairs(makeStreamsCandidates(CONFIG_VALUE(THROUGHPUT), 0, 1)),
+              (std::vector<std::pair<int, int>>{{1, 0}}));
+}
+
+TEST(StreamsAutoTuningTest, latencyCandidates) {
+    ASSERT_EQ(toPairs(makeStreamsCandidates(CONFIG_VALUE(LATENCY), 0, 8)),
+              (std::vector<std::pair<int, int>>{{ov::streams::NUMA, 0}, {1, 0}, {1, 4}, {1, 2}}));
+    ASSERT_EQ(toPairs(makeStreamsCandidates(CONFIG_VALUE(LATENCY), 0, 2)),
+              (std::vector<std::pair<int, int>>{{ov::streams::NUMA, 0}, {1, 0}, {1, 1}}));
+}
+
+TEST(StreamsAutoTuningTest, noCandidatesWithoutHint) {
+    ASSERT_TRUE(makeStreamsCandidates("", 4, 16).empty());
+}
@@ -0,0 +1,128 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+TEST(WeightsSharingTest, PackedWeightsKey) {
+    using tag = dnnl::memory::format_tag;
+    const dnnl::memory::desc src({2, 3}, dnnl::memory::data_type::f32, tag::ab);
+    const dnnl::memory::desc dst({2, 3}, dnnl::memory::data_type::f32, tag::ba);
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    const auto copy = data;
+    const auto size = data.size() * sizeof(float);
+
+    const auto key = WeightsSharing::packedWeightsKey(src, data.data(), size, dst);
+    ASSERT_EQ(key, WeightsSharing::packedWeightsKey(src, copy.data(), size, dst));
+    ASSERT_NE(key, WeightsSharing::packedWeightsKey(src, data.data(), size, src));
+
+    data[5] = 7;
+    ASSERT_NE(key, WeightsSharing::packedWeightsKey(src, data.data(), size, dst));
+}
+
+TEST(WeightsSharingTest, SharedUntilReleased) {
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const DnnlBlockedMemoryDesc desc(Precision::FP32, Shape(SizeVector{2, 3}));
+    int created = 0;
+    auto create = [&] {
+        created++;
+        auto memory = std::make_shared<Memory>(eng);
+        memory->Create(desc);
+        return memory;
+    };
+
+    auto cache = std::make_shared<WeightsSharing>();
+    MemoryPtr first = *cache->findOrCreate("key", create);
+    MemoryPtr second = *cache->findOrCreate("key", create);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(created, 1);
+
+    // the cache doesn't keep the memory alive
+    first.reset();
+    second.reset();
+    MemoryPtr third = *cache->findOrCreate("key", create);
+    ASSERT_EQ(created, 2);
+    ASSERT_NE(third, nullptr);
+}
+
+TEST(WeightsSharingTest, PackedReusedForSameSourceOnly) {
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const DnnlBlockedMemoryDesc desc(Precision::FP32, Shape(SizeVector{2, 3}));
+    int created = 0;
+    auto create = [&] {
+        created++;
+        auto memory = std::make_shared<Memory>(eng);
+        memory->Create(desc);
+        return memory;
+    };
+    auto source = [](std::vector<float> values) {
+        return std::make_shared<std::vector<float>>(std::move(values));
+    };
+    auto data = [](const std::shared_ptr<std::vector<float>>& values) {
+        return std::shared_ptr<const void>(values, values->data());
+    };
+    const size_t size = 6 * sizeof(float);
+
+    auto cache = std::make_shared<WeightsSharing>();
+    auto first = source({1, 2, 3, 4, 5, 6});
+    MemoryPtr firstPacked = *cache->findOrCreatePacked("key", create, data(first), size);
+
+    // the same bytes in the other buffer
+    auto copy = source(*first);
+    MemoryPtr copyPacked = *cache->findOrCreatePacked("key", create, data(copy), size);
+    ASSERT_EQ(firstPacked, copyPacked);
+    ASSERT_EQ(created, 1);
+
+    // the colliding key of the different data
+    auto other = source({1, 2, 3, 4, 5, 7});
+    MemoryPtr otherPacked = *cache->findOrCreatePacked("key", create, data(other), size);
+    ASSERT_NE(firstPacked, otherPacked);
+    ASSERT_EQ(created, 2);
+
+    // the source of the cached memory is released while the memory is used, the memory takes the new source
+    other.reset();
+    auto otherCopy = source({1, 2, 3, 4, 5, 7});
+    MemoryPtr otherPackedAgain = *cache->findOrCreatePacked("key", create, data(otherCopy), size);
+    ASSERT_EQ(otherPackedAgain, otherPacked);
+    ASSERT_EQ(created, 2);
+
+    // the new source is compared with
+    MemoryPtr copyPackedAgain = *cache->findOrCreatePacked("key", create, data(copy), size);
+    ASSERT_NE(copyPackedAgain, otherPacked);
+    ASSERT_EQ(created, 3);
+}
+
+TEST(WeightsSharingTest, DifferentKeysCreatedInParallel) {
+    const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto cache = std::make_shared<WeightsSharing>();
+    std::promise<void> firstStarted, secondCreated;
+    bool secondCreatedInParallel = false;
+
+    std::thread first([&] {
+        cache->findOrCreate("first", [&] {
+            firstStarted.set_value();
+            auto created = secondCreated.get_future().wait_for(std::chrono::seconds(10));
+            secondCreatedInParallel = created == std::future_status::ready;
+            return std::make_shared<Memory>(eng);
+        });
+    });
+    firstStarted.get_future().wait();
+    cache->findOrCreate("second", [&] {
+        return std::make_shared<Memory>(eng);
+    });
+    secondCreated.set_value();
+    first.join();
+
+    ASSERT_TRUE(secondCreatedInParallel);
+}
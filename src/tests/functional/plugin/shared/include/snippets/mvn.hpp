@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        std::pair<ov::Shape, ov::Shape>,  // Input Shapes
+        bool,                             // Normalize variance
+        ov::op::MVNEpsMode,               // Eps mode
+        size_t,                           // Expected num nodes
+        size_t,                           // Expected num subgraphs
+        std::string                       // Target Device
+> AddMVNParams;
+
+class AddMVN : public testing::WithParamInterface<ov::test::snippets::AddMVNParams>,
+               virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddMVNParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
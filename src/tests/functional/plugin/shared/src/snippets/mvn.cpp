@@ -0,0 +1,57 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/mvn.hpp"
+#include "subgraph_mvn.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string AddMVN::getTestCaseName(testing::TestParamInfo<ov::test::snippets::AddMVNParams> obj) {
+    std::pair<ov::Shape, ov::Shape> inputShapes;
+    bool normalizeVariance;
+    ov::op::MVNEpsMode epsMode;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    std::tie(inputShapes, normalizeVariance, epsMode, num_nodes, num_subgraphs, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes.first) << "_";
+    result << "IS[1]=" << CommonTestUtils::vec2str(inputShapes.second) << "_";
+    result << "NormVariance=" << normalizeVariance << "_";
+    result << "EpsMode=" << (epsMode == ov::op::MVNEpsMode::INSIDE_SQRT ? "INSIDE_SQRT" : "OUTSIDE_SQRT") << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void AddMVN::SetUp() {
+    std::pair<ov::Shape, ov::Shape> inputShapes;
+    bool normalizeVariance;
+    ov::op::MVNEpsMode epsMode;
+    std::tie(inputShapes, normalizeVariance, epsMode, ref_num_nodes, ref_num_subgraphs, targetDevice) = this->GetParam();
+    init_input_shapes({{{}, {inputShapes.first, }}, {{}, {inputShapes.second, }}});
+
+    auto f = ov::test::snippets::AddMVNFunction({inputShapes.first, inputShapes.second}, normalizeVariance, epsMode);
+    function = f.getOriginal();
+
+    if (!configuration.count(InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE)) {
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::IGNORE_CALLBACK});
+    }
+}
+
+TEST_P(AddMVN, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,40 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/ngraph.hpp"
+#include "./snippets_helpers.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+/// LayerNorm pattern with the residual connection: MVN over the last axis surrounded by eltwise ops.
+/// Tokenized into the single Subgraph, supported through MVNDecomposition
+//   in1       in2
+//        Add      Const(axes)
+//            MVN
+//      Multiply(Const(gamma))
+//        Add(Const(beta))
+//          Result
+class AddMVNFunction : public SnippetsFunctionBase {
+public:
+    explicit AddMVNFunction(const std::vector<PartialShape>& inputShapes, bool normalizeVariance, ov::op::MVNEpsMode epsMode)
+            : SnippetsFunctionBase(inputShapes), normalize_variance(normalizeVariance), eps_mode(epsMode) {
+        NGRAPH_CHECK(input_shapes.size() == 2, "Got invalid number of input shapes");
+        NGRAPH_CHECK(input_shapes[0].rank().is_static() && input_shapes[0].rbegin()->is_static(),
+                     "The last dimension of input shape must be static");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+    std::shared_ptr<ov::Model> initReference() const override;
+
+    bool normalize_variance;
+    ov::op::MVNEpsMode eps_mode;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,55 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_mvn.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include <snippets/op/subgraph.hpp>
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+const float eps = 1e-5f;
+
+std::shared_ptr<Node> makeLayerNorm(const Output<Node>& data, const Output<Node>& gamma, const Output<Node>& beta,
+                                    bool normalize_variance, ov::op::MVNEpsMode eps_mode) {
+    auto axes = op::v0::Constant::create(ov::element::i64, Shape{1}, {-1});
+    auto mvn = std::make_shared<op::v6::MVN>(data, axes, normalize_variance, eps, eps_mode);
+    auto mul = std::make_shared<op::v1::Multiply>(mvn, gamma);
+    return std::make_shared<op::v1::Add>(mul, beta);
+}
+} // namespace
+
+std::shared_ptr<ov::Model> AddMVNFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    const auto channels = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+    auto gamma = op::v0::Constant::create(precision, Shape{channels}, CommonTestUtils::generate_float_numbers(channels, 0.5f, 1.5f));
+    auto beta = op::v0::Constant::create(precision, Shape{channels}, CommonTestUtils::generate_float_numbers(channels, -1.f, 1.f));
+    auto add = std::make_shared<op::v1::Add>(data0, data1);
+    auto layer_norm = makeLayerNorm(add, gamma, beta, normalize_variance, eps_mode);
+    return std::make_shared<ov::Model>(NodeVector{layer_norm}, ParameterVector{data0, data1});
+}
+std::shared_ptr<ov::Model> AddMVNFunction::initReference() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
+    const auto channels = static_cast<size_t>(input_shapes[0].rbegin()->get_length());
+    auto gamma = op::v0::Constant::create(precision, Shape{channels}, CommonTestUtils::generate_float_numbers(channels, 0.5f, 1.5f));
+    auto beta = op::v0::Constant::create(precision, Shape{channels}, CommonTestUtils::generate_float_numbers(channels, -1.f, 1.f));
+    auto indata0 = std::make_shared<op::v0::Parameter>(precision, data0->get_output_partial_shape(0));
+    auto indata1 = std::make_shared<op::v0::Parameter>(precision, data1->get_output_partial_shape(0));
+    auto ingamma = std::make_shared<op::v0::Parameter>(precision, gamma->get_output_partial_shape(0));
+    auto inbeta = std::make_shared<op::v0::Parameter>(precision, beta->get_output_partial_shape(0));
+    auto add = std::make_shared<op::v1::Add>(indata0, indata1);
+    auto layer_norm = makeLayerNorm(add, ingamma, inbeta, normalize_variance, eps_mode);
+    auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{data0, data1, gamma, beta},
+                                          std::make_shared<ov::Model>(NodeVector{layer_norm},
+                                                                      ParameterVector{indata0, indata1, ingamma, inbeta}));
+    return std::make_shared<ov::Model>(NodeVector{subgraph}, ParameterVector{data0, data1});
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
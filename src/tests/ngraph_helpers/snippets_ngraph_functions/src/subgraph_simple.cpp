@@ -19,8 +19,8 @@ std::shared_ptr<ov::Model> AddFunction::initOriginal() const {
 std::shared_ptr<ov::Model> AddFunction::initReference() const {
     auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
     auto data1 = std::make_shared<op::v0::Parameter>(precision, input_shapes[1]);
-    auto indata0 = std::make_shared<op::v0::Parameter>(precision, data0->get_shape());
-    auto indata1 = std::make_shared<op::v0::Parameter>(precision, data1->get_shape());
+    auto indata0 = std::make_shared<op::v0::Parameter>(precision, data0->get_output_partial_shape(0));
+    auto indata1 = std::make_shared<op::v0::Parameter>(precision, data1->get_output_partial_shape(0));
     auto add = std::make_shared<ngraph::snippets::op::Subgraph>(NodeVector{data0, data1},
                                           std::make_shared<ov::Model>(NodeVector{std::make_shared<op::v1::Add>(indata0, indata1)},
                                                                       ParameterVector{indata0, indata1}));
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <limits>
+#include "common.hpp"
+
+using namespace MockMultiDevicePlugin;
+
+class DeviceStatisticsTest : public ::testing::Test {
+public:
+    DeviceStatistics statistics;
+
+    void SetUp() override {
+        statistics._numWorkers = 2;
+    }
+
+    void complete(double latencyMs) {
+        statistics.RequestStarted();
+        auto start = std::chrono::steady_clock::now() -
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::milli>(latencyMs));
+        statistics.RequestCompleted(start);
+    }
+};
+
+TEST_F(DeviceStatisticsTest, noSamplesIdleDeviceIsPreferred) {
+    EXPECT_EQ(statistics.ExpectedCompletionTime(), 0.0);
+}
+
+TEST_F(DeviceStatisticsTest, noSamplesBusyDeviceIsNotWaitedFor) {
+    statistics.RequestStarted();
+    statistics.RequestStarted();
+    EXPECT_EQ(statistics.ExpectedCompletionTime(), std::numeric_limits<double>::max());
+}
+
+TEST_F(DeviceStatisticsTest, firstSampleSetsLatency) {
+    complete(10.0);
+    EXPECT_NEAR(statistics._latencyMs, 10.0, 1.0);
+    EXPECT_EQ(statistics._inferCount, 1u);
+    EXPECT_EQ(statistics._inFlight, 0u);
+}
+
+TEST_F(DeviceStatisticsTest, latencyIsExponentiallyWeighted) {
+    complete(10.0);
+    complete(20.0);
+    EXPECT_NEAR(statistics._latencyMs, 10.0 + DeviceStatistics::ewmaAlpha * 10.0, 1.0);
+}
+
+TEST_F(DeviceStatisticsTest, expectedCompletionIncludesQueueing) {
+    complete(10.0);
+    const auto idle = statistics.ExpectedCompletionTime();
+    statistics.RequestStarted();
+    statistics.RequestStarted();
+    // both requests of the device are in flight, a new one has to wait
+    EXPECT_NEAR(statistics.ExpectedCompletionTime(), idle * 1.5, 1e-6);
+}
+
+TEST_F(DeviceStatisticsTest, staleIdleDeviceIsProbed) {
+    complete(10.0);
+    const auto now = std::chrono::steady_clock::now();
+    const auto later = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<double, std::milli>(DeviceStatistics::probeIntervalMs + 1.0));
+    EXPECT_NEAR(statistics.ExpectedCompletionTime(now), 10.0, 1.0);
+    EXPECT_EQ(statistics.ExpectedCompletionTime(later), 0.0);
+    // the busy device is not probed
+    statistics.RequestStarted(now);
+    statistics.RequestStarted(now);
+    EXPECT_GT(statistics.ExpectedCompletionTime(later), 0.0);
+}
+
+TEST_F(DeviceStatisticsTest, reportsAllFields) {
+    complete(10.0);
+    auto report = statistics.ToAnyMap();
+    EXPECT_EQ(report.count("LATENCY_MS"), 1u);
+    EXPECT_EQ(report.count("THROUGHPUT_FPS"), 1u);
+    EXPECT_EQ(report.at("INFER_COUNT").as<uint64_t>(), 1u);
+    EXPECT_EQ(report.at("IN_FLIGHT").as<uint64_t>(), 0u);
+}
@@ -0,0 +1,117 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "multi_schedule.hpp"
+
+using namespace MockMultiDevicePlugin;
+
+namespace {
+// MULTI schedule with the fake worker requests: a scheduled task records the device of the worker
+// and keeps the worker busy, the latencies of the devices are set by the completed requests
+class LoadAwareSchedule : public MultiSchedule {
+public:
+    LoadAwareSchedule(const std::vector<std::string>& devices, size_t numWorkers) {
+        _multiSContext = std::make_shared<MultiScheduleContext>();
+        _multiSContext->_schedulePolicy = ov::intel_auto::SchedulePolicy::LOAD_AWARE;
+        for (auto&& device : devices) {
+            DeviceInformation info{};
+            info.deviceName = device;
+            _multiSContext->_devicePriorities.push_back(info);
+            auto& statistics = _multiSContext->_deviceStatistics[device];
+            statistics._numWorkers = numWorkers;
+            _inferPipelineTasksDeviceSpecific[device].reset(new IE::ThreadSafeQueue<IE::Task>);
+            _idleWorkerRequests[device].set_capacity(numWorkers);
+            _workerRequests[device].resize(numWorkers);
+            for (auto&& workerRequest : _workerRequests[device]) {
+                workerRequest._statistics = &statistics;
+                _idleWorkerRequests[device].try_push(&workerRequest);
+            }
+        }
+    }
+
+    // returns the device which runs the request or the empty string if the request is queued
+    std::string Schedule() {
+        std::string device;
+        ScheduleToWorkerInferRequest([&] {
+            for (auto&& workerRequests : _workerRequests) {
+                for (auto&& workerRequest : workerRequests.second) {
+                    if (&workerRequest == _thisWorkerInferRequest)
+                        device = workerRequests.first;
+                }
+            }
+            _thisWorkerInferRequest->_statistics->RequestStarted();
+        });
+        return device;
+    }
+
+    bool IsQueued(const std::string& device) {
+        IE::Task task;
+        return _inferPipelineTasksDeviceSpecific[device]->try_pop(task);
+    }
+
+    DeviceStatistics& Statistics(const std::string& device) {
+        return _multiSContext->_deviceStatistics.at(device);
+    }
+
+    // completes a request which has taken latencyMs on the device without taking its worker
+    void Complete(const std::string& device, double latencyMs) {
+        auto start = std::chrono::steady_clock::now() -
+                     std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                         std::chrono::duration<double, std::milli>(latencyMs));
+        Statistics(device).RequestStarted(start);
+        Statistics(device).RequestCompleted(start);
+    }
+};
+}  // namespace
+
+TEST(LoadAwareScheduleTest, fasterDeviceIsPreferred) {
+    LoadAwareSchedule schedule({"CPU", "GPU"}, 2);
+    schedule.Complete("CPU", 30.0);
+    schedule.Complete("GPU", 10.0);
+    EXPECT_EQ(schedule.Schedule(), "GPU");
+    EXPECT_EQ(schedule.Schedule(), "GPU");
+}
+
+TEST(LoadAwareScheduleTest, deviceWithoutSamplesIsTriedFirst) {
+    LoadAwareSchedule schedule({"CPU", "GPU"}, 1);
+    schedule.Complete("GPU", 10.0);
+    EXPECT_EQ(schedule.Schedule(), "CPU");
+}
+
+TEST(LoadAwareScheduleTest, busyFasterDeviceIsWaitedFor) {
+    LoadAwareSchedule schedule({"CPU", "GPU"}, 1);
+    schedule.Complete("CPU", 30.0);
+    schedule.Complete("GPU", 10.0);
+    EXPECT_EQ(schedule.Schedule(), "GPU");
+    // the queueing on GPU is expected to take less than the inference on CPU
+    EXPECT_EQ(schedule.Schedule(), "");
+    EXPECT_TRUE(schedule.IsQueued("GPU"));
+    EXPECT_FALSE(schedule.IsQueued("CPU"));
+}
+
+TEST(LoadAwareScheduleTest, busyDeviceFallsBackToSlowerOne) {
+    LoadAwareSchedule schedule({"CPU", "GPU"}, 1);
+    schedule.Complete("CPU", 15.0);
+    schedule.Complete("GPU", 10.0);
+    EXPECT_EQ(schedule.Schedule(), "GPU");
+    // waiting for GPU is expected to take 20 ms
+    EXPECT_EQ(schedule.Schedule(), "CPU");
+}
+
+TEST(LoadAwareScheduleTest, staleSlowerDeviceIsProbed) {
+    LoadAwareSchedule schedule({"CPU", "GPU"}, 2);
+    schedule.Complete("CPU", 30.0);
+    schedule.Complete("GPU", 10.0);
+    // CPU didn't get a request since its latency was measured
+    schedule.Statistics("CPU")._lastStartTime -=
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double, std::milli>(2 * DeviceStatistics::probeIntervalMs));
+    EXPECT_EQ(schedule.Schedule(), "CPU");
+    // the probe refreshes the start time, so the next request goes to the faster device again
+    EXPECT_EQ(schedule.Schedule(), "GPU");
+}